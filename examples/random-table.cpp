@@ -0,0 +1,152 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/int/extensional.hh>
+
+#include <algorithm>
+
+using namespace Gecode;
+
+/** \brief Options for %RandomTable problems
+ *
+ * \relates RandomTable
+ */
+class RandomTableOptions : public Options {
+protected:
+  Driver::UnsignedIntOption _vars;   ///< Number of variables
+  Driver::UnsignedIntOption _values; ///< Size of domains
+  Driver::UnsignedIntOption _arity;  ///< Arity of tables
+  Driver::UnsignedIntOption _tables; ///< Number of tables
+  Driver::UnsignedIntOption _tuples; ///< Number of tuples per table
+  Driver::UnsignedIntOption _seed;   ///< Seed for generating tables
+  Driver::BoolOption _kernels;       ///< Whether to use vectorized kernels
+public:
+  /// Initialize options for example with name \a s
+  RandomTableOptions(const char* s)
+    : Options(s),
+      _vars("vars","number of variables",30),
+      _values("values","size of variable domains",10),
+      _arity("arity","arity of tables",6),
+      _tables("tables","number of tables",20),
+      _tuples("tuples","number of tuples per table",50000),
+      _seed("seed","seed for random tables",1),
+      _kernels("kernels","whether to use vectorized bit set kernels",true) {
+    add(_vars); add(_values); add(_arity); add(_tables); add(_tuples);
+    add(_seed); add(_kernels);
+  }
+  /// Return number of variables
+  int vars(void) const { return static_cast<int>(_vars.value()); }
+  /// Return size of domains
+  int values(void) const { return static_cast<int>(_values.value()); }
+  /// Return arity of tables
+  int arity(void) const { return static_cast<int>(_arity.value()); }
+  /// Return number of tables
+  int tables(void) const { return static_cast<int>(_tables.value()); }
+  /// Return number of tuples per table
+  int tuples(void) const { return static_cast<int>(_tuples.value()); }
+  /// Return seed
+  unsigned int seed(void) const { return _seed.value(); }
+  /// Return whether to use vectorized kernels
+  bool kernels(void) const { return _kernels.value(); }
+};
+
+/**
+ * \brief %Example: Random table constraints
+ *
+ * Posts table constraints with random tuples over random scopes
+ * and searches for a solution. As large tables are propagated by
+ * the compact table propagator with bit sets of many words, the
+ * example serves as a benchmark for the bit set operations: run it
+ * in time mode with and without vectorized kernels (option
+ * <code>-kernels</code>).
+ *
+ * \ingroup Example
+ *
+ */
+class RandomTable : public Script {
+protected:
+  /// Variables
+  IntVarArray x;
+public:
+  /// Actual model
+  RandomTable(const RandomTableOptions& opt)
+    : Script(opt), x(*this,opt.vars(),0,opt.values()-1) {
+    Int::Extensional::BitSetKernel::enable(opt.kernels());
+    Rnd r(opt.seed());
+    int a = std::min(opt.arity(),opt.vars());
+    for (int t=0; t<opt.tables(); t++) {
+      // Random scope without repetitions
+      IntArgs s(IntArgs::create(opt.vars(),0));
+      for (int i=0; i<a; i++)
+        std::swap(s[i],s[i+static_cast<int>(r(opt.vars()-i))]);
+      IntVarArgs y(a);
+      for (int i=0; i<a; i++)
+        y[i] = x[s[i]];
+      // Random tuples
+      TupleSet ts(a);
+      IntArgs tuple(a);
+      for (int n=0; n<opt.tuples(); n++) {
+        for (int i=0; i<a; i++)
+          tuple[i] = static_cast<int>(r(opt.values()));
+        ts.add(tuple);
+      }
+      ts.finalize();
+      extensional(*this, y, ts);
+    }
+    branch(*this, x, INT_VAR_AFC_SIZE_MAX(opt.decay()), INT_VAL_MIN());
+  }
+  /// Constructor for cloning \a s
+  RandomTable(RandomTable& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Copy during cloning
+  virtual Space*
+  copy(void) {
+    return new RandomTable(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tx[] = " << x << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates RandomTable
+ */
+int
+main(int argc, char* argv[]) {
+  RandomTableOptions opt("RandomTable");
+  opt.solutions(1);
+  opt.parse(argc,argv);
+  Script::run<RandomTable,DFS,RandomTableOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -82,7 +82,7 @@ public:
  *
  * This example parses a dimacs CNF file in which
  * the constraints are specified. For each line of
- * the file a clause propagator is posted.
+ * the file a clause is posted.
  *
  * Format of dimacs CNF files:
  *
@@ -106,6 +106,14 @@ public:
  * Benchmarks on satlib.org, for instance,
  * are in the dimacs CNF format.
  *
+ * By default, a propagator is posted for each clause and
+ * branching selects variables by their accumulated failure count
+ * (model <code>clause</code>). With model <code>clauses</code> a
+ * single propagator is posted for all clauses, which requires
+ * considerably less memory and time for cloning. As the failure
+ * count then is the same for all variables, branching selects
+ * variables by their action instead.
+ *
  * \ingroup Example
  */
 class Sat : public Script {
@@ -113,11 +121,19 @@ private:
   /// The Boolean variables
   BoolVarArray x;
 public:
+  /// Model variants
+  enum {
+    MODEL_CLAUSE, ///< Post a propagator for each clause
+    MODEL_CLAUSES ///< Post a single propagator for all clauses
+  };
   /// The actual problem
   Sat(const SatOptions& opt)
     : Script(opt) {
-    parseDIMACS(opt.filename.c_str());
-    branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
+    parseDIMACS(opt.filename.c_str(), opt.model());
+    if (opt.model() == MODEL_CLAUSES)
+      branch(*this, x, BOOL_VAR_ACTION_MAX(), BOOL_VAL_MIN());
+    else
+      branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
   }
 
   /// Constructor for cloning
@@ -137,8 +153,8 @@ public:
     os << "solution:\n" << x << std::endl;
   }
 
-  /// Post constraints according to DIMACS file \a f
-  void parseDIMACS(const char* f) {
+  /// Post constraints according to DIMACS file \a f and model \a m
+  void parseDIMACS(const char* f, int m) {
     int variables = 0;
     int clauses = 0;
     std::ifstream dimacs(f);
@@ -150,6 +166,8 @@ public:
               << std::endl;
     std::string line;
     int c = 0;
+    // Literals of all clauses, each clause terminated by 0
+    std::vector<int> cl;
     while (dimacs.good()) {
       std::getline(dimacs,line);
       // Comments (ignore them)
@@ -206,17 +224,26 @@ public:
           }
         }
 
-        // Create positive BoolVarArgs
-        BoolVarArgs positives(pos.size());
-        for (int i=pos.size(); i--;)
-          positives[i] = x[pos[i]];
+        if (m == MODEL_CLAUSES) {
+          // Collect literals, the clauses are posted at the end
+          for (unsigned int i=0; i<pos.size(); i++)
+            cl.push_back(pos[i]+1);
+          for (unsigned int i=0; i<neg.size(); i++)
+            cl.push_back(-(neg[i]+1));
+          cl.push_back(0);
+        } else {
+          // Create positive BoolVarArgs
+          BoolVarArgs positives(pos.size());
+          for (int i=pos.size(); i--;)
+            positives[i] = x[pos[i]];
 
-        BoolVarArgs negatives(neg.size());
-        for (int i=neg.size(); i--;)
-          negatives[i] = x[neg[i]];
+          BoolVarArgs negatives(neg.size());
+          for (int i=neg.size(); i--;)
+            negatives[i] = x[neg[i]];
 
-        // Post propagators
-        clause(*this, BOT_OR, positives, negatives, 1);
+          // Post propagators
+          clause(*this, BOT_OR, positives, negatives, 1);
+        }
       }
       else {
         std::cerr << "format error in dimacs file" << std::endl;
@@ -225,6 +252,8 @@ public:
       }
     }
     dimacs.close();
+    if (m == MODEL_CLAUSES)
+      Gecode::clauses(*this, x, cl);
     if (clauses != c) {
       std::cerr << "error: number of specified clauses seems to be wrong."
                 << std::endl;
@@ -240,6 +269,11 @@ public:
 int main(int argc, char* argv[]) {
 
   SatOptions opt("SAT");
+  opt.model(Sat::MODEL_CLAUSE);
+  opt.model(Sat::MODEL_CLAUSE, "clause",
+            "post a propagator for each clause");
+  opt.model(Sat::MODEL_CLAUSES, "clauses",
+            "post a single propagator for all clauses");
   opt.parse(argc,argv);
 
   // Check whether all arguments are successfully parsed
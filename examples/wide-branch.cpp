@@ -0,0 +1,116 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Branching on many weakly constrained variables
+ *
+ * Branches on a large array of variables with random lower bounds
+ * where only neighbouring variables are constrained to be
+ * different. As propagation is cheap, the runtime is dominated by
+ * variable selection. The example serves as a benchmark for
+ * heap-based variable selection: with branching <code>heap</code>
+ * the variable with smallest domain is selected with
+ * INT_VAR_SIZE_MIN (which uses a heap for large arrays), with
+ * branching <code>scan</code> the same variable is selected by
+ * scanning all variables with an equivalent merit function.
+ *
+ * \ingroup Example
+ *
+ */
+class WideBranch : public Script {
+protected:
+  /// Variables
+  IntVarArray x;
+public:
+  /// Branching to use for model
+  enum {
+    BRANCH_HEAP, ///< Select variable with smallest domain by heap
+    BRANCH_SCAN  ///< Select variable with smallest domain by scanning
+  };
+  /// Actual model
+  WideBranch(const SizeOptions& opt)
+    : Script(opt), x(*this,static_cast<int>(opt.size()),0,99) {
+    Rnd r(opt.seed());
+    for (int i=0; i<x.size(); i++)
+      rel(*this, x[i], IRT_GQ, static_cast<int>(r(100U)));
+    for (int i=0; i+1<x.size(); i+=2)
+      rel(*this, x[i], IRT_NQ, x[i+1]);
+    switch (opt.branching()) {
+    case BRANCH_HEAP:
+      branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+      break;
+    case BRANCH_SCAN:
+      branch(*this, x,
+             INT_VAR_MERIT_MIN([](const Space&, IntVar y, int) {
+                 return static_cast<double>(y.size());
+               }),
+             INT_VAL_MIN());
+      break;
+    }
+  }
+  /// Constructor for cloning \a s
+  WideBranch(WideBranch& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Copy during cloning
+  virtual Space*
+  copy(void) {
+    return new WideBranch(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tx[] = " << x << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates WideBranch
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("WideBranch");
+  opt.size(10000);
+  opt.solutions(1);
+  // Avoid a copy for every few of the many decisions
+  opt.c_d(1024);
+  opt.branching(WideBranch::BRANCH_HEAP);
+  opt.branching(WideBranch::BRANCH_HEAP, "heap",
+                "select smallest domain by heap");
+  opt.branching(WideBranch::BRANCH_SCAN, "scan",
+                "select smallest domain by scanning");
+  opt.parse(argc,argv);
+  Script::run<WideBranch,DFS,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
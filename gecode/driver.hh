@@ -382,6 +382,7 @@ namespace Gecode {
     Driver::StringOption      _search;        ///< Search options
     Driver::UnsignedIntOption _solutions;     ///< How many solutions
     Driver::DoubleOption      _threads;       ///< How many threads to use
+    Driver::BoolOption        _affinity;      ///< Whether to pin threads
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
@@ -408,6 +409,7 @@ namespace Gecode {
     Driver::StringValueOption _out_file;      ///< Where to print solutions
     Driver::StringValueOption _log_file;      ///< Where to print statistics
     Driver::TraceOption       _trace;         ///< Trace flags for tracing
+    Driver::BoolOption        _profile;       ///< Whether to profile propagators
 
 #ifdef GECODE_HAS_CPPROFILER
     Driver::IntOption         _profiler_id;   ///< Use this execution id for the CP-profiler
@@ -491,6 +493,11 @@ namespace Gecode {
     /// Return number of parallel threads
     double threads(void) const;
 
+    /// Set whether to pin threads to processing units
+    void affinity(bool b);
+    /// Return whether to pin threads to processing units
+    bool affinity(void) const;
+
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
     /// Return copy recomputation distance
@@ -604,6 +611,11 @@ namespace Gecode {
     /// Return trace flags
     int trace(void) const;
 
+    /// Set whether to profile propagators (stat mode)
+    void profile(bool b);
+    /// Return whether to profile propagators (stat mode)
+    bool profile(void) const;
+
 #ifdef GECODE_HAS_CPPROFILER
     /// Set profiler execution identifier
     void profiler_id(int i);
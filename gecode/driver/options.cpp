@@ -588,6 +588,9 @@ namespace Gecode {
       _solutions("solutions","number of solutions (0 = all)",1),
       _threads("threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _affinity("threads-affinity",
+                "whether to pin threads to processing units",
+                Search::Config::affinity),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
@@ -618,7 +621,9 @@ namespace Gecode {
                 "(supports stdout, stdlog, stderr)","stdout"),
       _log_file("file-stat", "where to print statistics "
                 "(supports stdout, stdlog, stderr)","stdout"),
-      _trace(0)
+      _trace(0),
+      _profile("profile",
+               "whether to profile propagators (stat mode)",false)
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -643,15 +648,15 @@ namespace Gecode {
 
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
-    add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
-    add(_d_l);
+    add(_search); add(_solutions); add(_threads); add(_affinity);
+    add(_c_d); add(_a_d); add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
     add(_nogoods); add(_nogoods_limit);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
-    add(_out_file); add(_log_file); add(_trace);
+    add(_out_file); add(_log_file); add(_trace); add(_profile);
 #ifdef GECODE_HAS_CPPROFILER
     add(_profiler_id);
     add(_profiler_port);
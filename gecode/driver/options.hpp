@@ -297,6 +297,15 @@ namespace Gecode {
     return _threads.value();
   }
 
+  inline void
+  Options::affinity(bool b) {
+    _affinity.value(b);
+  }
+  inline bool
+  Options::affinity(void) const {
+    return _affinity.value();
+  }
+
   inline void
   Options::c_d(unsigned int d) {
     _c_d.value(d);
@@ -505,6 +514,15 @@ namespace Gecode {
     return _trace.value();
   }
 
+  inline void
+  Options::profile(bool b) {
+    _profile.value(b);
+  }
+  inline bool
+  Options::profile(void) const {
+    return _profile.value();
+  }
+
 #ifdef GECODE_HAS_CPPROFILER
 
   /*
@@ -370,6 +370,7 @@ namespace Gecode { namespace Driver {
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
           so.threads = o.threads();
+          so.affinity = o.affinity();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
           so.d_l     = o.d_l();
@@ -466,8 +467,21 @@ namespace Gecode { namespace Driver {
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
 
+          Profiler* pr = NULL;
+          if (o.profile()) {
+            pr = new Profiler;
+            try {
+              trace(*s, TE_PROPAGATE, *pr);
+            } catch (MoreThanOneTracer&) {
+              l_out << "Cannot profile a script that uses tracing..."
+                    << endl;
+              delete pr; pr = NULL;
+            }
+          }
+
           so.clone   = false;
           so.threads = o.threads();
+          so.affinity = o.affinity();
           so.assets  = o.assets();
           so.slice   = o.slice();
           so.c_d     = o.c_d();
@@ -510,8 +524,13 @@ namespace Gecode { namespace Driver {
                   << endl
 #endif
                   << endl;
+            if (pr != NULL) {
+              pr->print(l_out);
+              l_out << endl;
+            }
           }
           delete so.stop;
+          delete pr;
         }
         break;
       case SM_TIME:
@@ -528,6 +547,7 @@ namespace Gecode { namespace Driver {
               Search::Options sok;
               sok.clone   = false;
               sok.threads = o.threads();
+              sok.affinity = o.affinity();
               sok.assets  = o.assets();
               sok.slice   = o.slice();
               sok.c_d     = o.c_d();
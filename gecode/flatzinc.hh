@@ -230,6 +230,9 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::IntOption         _solutions; ///< How many solutions
       Gecode::Driver::BoolOption        _allSolutions; ///< Return all solutions
       Gecode::Driver::DoubleOption      _threads;   ///< How many threads to use
+      Gecode::Driver::BoolOption        _affinity;  ///< Whether to pin threads
+      Gecode::Driver::StringOption      _p_mode;    ///< How parallel search distributes work
+      Gecode::Driver::BoolOption        _p_replay;  ///< Whether parallel search returns solutions in reproducible order
       Gecode::Driver::BoolOption        _free; ///< Use free search
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
@@ -244,6 +247,8 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _r_scale;   ///< Restart scale factor
       Gecode::Driver::BoolOption        _nogoods;   ///< Whether to use no-goods
       Gecode::Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for extracting no-goods
+      Gecode::Driver::UnsignedIntOption _assets;    ///< Number of portfolio assets
+      Gecode::Driver::UnsignedIntOption _slice;     ///< Portfolio slice
       Gecode::Driver::BoolOption        _interrupt; ///< Whether to catch SIGINT
       Gecode::Driver::DoubleOption      _step;        ///< Step option
       //@}
@@ -252,6 +257,9 @@ namespace Gecode { namespace FlatZinc {
       //@{
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
+      Gecode::Driver::BoolOption        _profile;    ///< Profile propagators
+      Gecode::Driver::BoolOption        _stream;     ///< Post constraints while parsing
+      Gecode::Driver::UnsignedIntOption _prepare;    ///< Threads for preparing constraints
       Gecode::Driver::StringValueOption _output;     ///< Output file
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -271,6 +279,12 @@ namespace Gecode { namespace FlatZinc {
       _allSolutions("a", "return all solutions (equal to -n 0)"),
       _threads("p","number of threads (0 = #processing units)",
                Gecode::Search::Config::threads),
+      _affinity("p-affinity","whether to pin threads to processing units",
+                Gecode::Search::Config::affinity),
+      _p_mode("p-mode","how parallel search distributes work",
+              Gecode::Search::PM_STEAL),
+      _p_replay("p-replay","whether to return solutions in reproducible order (eps)",
+                false),
       _free("f", "free search, no need to follow search-specification"),
       _decay("decay","decay factor",0.99),
       _c_d("c-d","recomputation commit distance",Gecode::Search::Config::c_d),
@@ -286,11 +300,17 @@ namespace Gecode { namespace FlatZinc {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _assets("assets","#portfolio assets (0 = no portfolio)",0),
+      _slice("slice","portfolio slice (in #failures)",Search::Config::slice),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       _step("step","step distance for float optimization",0.0),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
+      _profile("profile","whether to profile propagators (stat mode)",false),
+      _stream("stream","whether to post constraints while parsing",false),
+      _prepare("prepare-threads",
+               "threads for preparing constraints (0 = #processing units)",1),
       _output("o","file to send output to")
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -305,13 +325,20 @@ namespace Gecode { namespace FlatZinc {
       _mode.add(Gecode::SM_STAT, "stat");
       _mode.add(Gecode::SM_GIST, "gist");
       _mode.add(Gecode::SM_CPPROFILER, "cpprofiler");
+      _p_mode.add(Gecode::Search::PM_STEAL, "steal",
+                  "idle threads steal work");
+      _p_mode.add(Gecode::Search::PM_EPS, "eps",
+                  "threads explore subproblems of a decomposition");
+      _p_mode.add(Gecode::Search::PM_DET, "det",
+                  "deterministic search in synchronized epochs");
       _restart.add(RM_NONE,"none");
       _restart.add(RM_CONSTANT,"constant");
       _restart.add(RM_LINEAR,"linear");
       _restart.add(RM_LUBY,"luby");
       _restart.add(RM_GEOMETRIC,"geometric");
 
-      add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_solutions); add(_threads); add(_affinity); add(_c_d); add(_a_d);
+      add(_p_mode); add(_p_replay);
       add(_allSolutions);
       add(_free);
       add(_decay);
@@ -320,7 +347,9 @@ namespace Gecode { namespace FlatZinc {
       add(_step);
       add(_restart); add(_r_base); add(_r_scale);
       add(_nogoods); add(_nogoods_limit);
-      add(_mode); add(_stat);
+      add(_assets); add(_slice);
+      add(_mode); add(_stat); add(_profile); add(_stream);
+      add(_prepare);
       add(_output);
 #ifdef GECODE_HAS_CPPROFILER
       add(_profiler_id);
@@ -351,6 +380,11 @@ namespace Gecode { namespace FlatZinc {
     int solutions(void) const { return _solutions.value(); }
     bool allSolutions(void) const { return _allSolutions.value(); }
     double threads(void) const { return _threads.value(); }
+    bool affinity(void) const { return _affinity.value(); }
+    Gecode::Search::ParallelMode parallel(void) const {
+      return static_cast<Gecode::Search::ParallelMode>(_p_mode.value());
+    }
+    bool replay(void) const { return _p_replay.value(); }
     bool free(void) const { return _free.value(); }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
@@ -360,6 +394,9 @@ namespace Gecode { namespace FlatZinc {
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
     const char* output(void) const { return _output.value(); }
+    bool profile(void) const { return _profile.value(); }
+    bool stream(void) const { return _stream.value(); }
+    unsigned int prepareThreads(void) const { return _prepare.value(); }
 
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -378,6 +415,8 @@ namespace Gecode { namespace FlatZinc {
     void restart_scale(int i) { _r_scale.value(i); }
     bool nogoods(void) const { return _nogoods.value(); }
     unsigned int nogoods_limit(void) const { return _nogoods_limit.value(); }
+    unsigned int assets(void) const { return _assets.value(); }
+    unsigned int slice(void) const { return _slice.value(); }
     bool interrupt(void) const { return _interrupt.value(); }
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -541,6 +580,15 @@ namespace Gecode { namespace FlatZinc {
     /// Create new float variable from specification
     void newFloatVar(FloatVarSpec* vs);
 
+    /**
+     * \brief Set number of threads for preparing constraints to \a n
+     *
+     * Before posting, the space-independent parts of constraints
+     * (tuple sets for table constraints and DFAs for regular
+     * constraints) are constructed in parallel by \a n threads
+     * (0 = #processing units). The default is to not use threads.
+     */
+    void prepareThreads(unsigned int n);
     /// Post a constraint specified by \a ce
     void postConstraints(std::vector<ConExpr*>& ces);
 
@@ -610,7 +658,14 @@ namespace Gecode { namespace FlatZinc {
     virtual void constrain(const Space& s);
     /// Copy function
     virtual Gecode::Space* copy(void);
-    /// Slave function for restarts
+    /**
+     * \brief Slave function for restarts and portfolio assets
+     *
+     * For restarts, the function implements LNS. For portfolio
+     * asset \f$i>0\f$, the branchers are replaced by a branching
+     * using a different heuristic (see FlatZinc::Portfolio), asset
+     * \f$0\f$ keeps the search defined by the solve annotations.
+     */
     virtual bool slave(const MetaInfo& mi);
 
     /// \name AST to variable and value conversion
@@ -637,6 +692,10 @@ namespace Gecode { namespace FlatZinc {
     IntVar arg2IntVar(AST::Node* n);
     /// Convert \a a to TupleSet
     TupleSet arg2tupleset(const IntArgs& a, int noOfVars);
+    /// Convert \a arg (array of integers, or Booleans if \a b) to TupleSet
+    TupleSet arg2tupleset(AST::Node* arg, int noOfVars, bool b=false);
+    /// Share TupleSet \a ts if possible
+    TupleSet getSharedTupleSet(TupleSet& ts);
     /// Check if \a b is array of Booleans (or has a single integer)
     bool isBoolArray(AST::Node* b, int& singleInt);
 #ifdef GECODE_HAS_SET_VARS
@@ -658,6 +717,14 @@ namespace Gecode { namespace FlatZinc {
     IntPropLevel ann2ipl(AST::Node* ann);
     /// Share DFA \a a if possible
     DFA getSharedDFA(DFA& a);
+    /**
+     * \brief Convert arguments to DFA
+     *
+     * The DFA has \a q states, \a s symbols, transition table \a d,
+     * start state \a q0, and set of final states \a f.
+     */
+    DFA arg2dfa(AST::Node* q, AST::Node* s, AST::Node* d,
+                AST::Node* q0, AST::Node* f);
     //@}
   };
 
@@ -675,21 +742,30 @@ namespace Gecode { namespace FlatZinc {
    * \brief Parse FlatZinc file \a fileName into \a fzs and return it.
    *
    * Creates a new empty FlatZincSpace if \a fzs is NULL.
+   *
+   * If \a stream is true, each constraint is posted as soon as it
+   * has been parsed rather than after the entire model has been
+   * read. This keeps the memory for the parsed constraints small,
+   * but equality constraints between variables are posted as
+   * propagators instead of making the variables aliases.
    */
   GECODE_FLATZINC_EXPORT
   FlatZincSpace* parse(const std::string& fileName,
                        Printer& p, std::ostream& err = std::cerr,
-                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd);
+                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd,
+                       bool stream=false);
 
   /**
    * \brief Parse FlatZinc from \a is into \a fzs and return it.
    *
-   * Creates a new empty FlatZincSpace if \a fzs is NULL.
+   * Creates a new empty FlatZincSpace if \a fzs is NULL. For \a stream
+   * see the function for parsing from a file.
    */
   GECODE_FLATZINC_EXPORT
   FlatZincSpace* parse(std::istream& is,
                        Printer& p, std::ostream& err = std::cerr,
-                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd);
+                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd,
+                       bool stream=false);
 
 }}
 
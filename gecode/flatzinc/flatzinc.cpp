@@ -47,6 +47,7 @@
 #include <sstream>
 #include <limits>
 #include <unordered_set>
+#include <unordered_map>
 
 
 namespace std {
@@ -766,9 +767,16 @@ namespace Gecode { namespace FlatZinc {
     typedef std::unordered_set<DFA> DFASet;
     /// Hash table of DFAs
     DFASet dfaSet;
-    
+
+    /// Number of threads for preparing constraints
+    unsigned int prepareThreads;
+    /// Tuple sets prepared for table constraints (by tuple argument)
+    std::unordered_map<AST::Node*,TupleSet> preparedTupleSets;
+    /// DFAs prepared for regular constraints (by transition argument)
+    std::unordered_map<AST::Node*,DFA> preparedDFAs;
+
     /// Initialize
-    FlatZincSpaceInitData(void) {}
+    FlatZincSpaceInitData(void) : prepareThreads(1) {}
   };
 
   FlatZincSpace::FlatZincSpace(FlatZincSpace& f)
@@ -1000,11 +1008,217 @@ namespace Gecode { namespace FlatZinc {
     };
   }
 
+  namespace {
+
+    /// Build tuple set for \a noOfVars variables from \a arg
+    TupleSet
+    buildTupleSet(AST::Node* arg, int noOfVars, bool b) {
+      AST::Array* a = arg->getArray();
+      int n = static_cast<int>(a->a.size());
+      int noOfTuples = n == 0 ? 0 : (n/noOfVars);
+      TupleSet ts(noOfVars);
+      IntArgs t(noOfVars);
+      for (int i=0; i<noOfTuples; i++) {
+        for (int j=0; j<noOfVars; j++) {
+          AST::Node* e = a->a[i*noOfVars+j];
+          t[j] = b ? e->getBool() : e->getInt();
+        }
+        ts.add(t);
+      }
+      ts.finalize();
+      return ts;
+    }
+
+    /// Build DFA from the arguments of a regular constraint
+    DFA
+    buildDFA(AST::Node* qn, AST::Node* sn, AST::Node* dn,
+             AST::Node* q0n, AST::Node* fn) {
+      int q = qn->getInt();
+      int symbols = sn->getInt();
+      AST::Array* d = dn->getArray();
+      int q0 = q0n->getInt();
+
+      int noOfTrans = 0;
+      for (int i=1; i<=q; i++) {
+        for (int j=1; j<=symbols; j++) {
+          if (d->a[(i-1)*symbols+(j-1)]->getInt() > 0)
+            noOfTrans++;
+        }
+      }
+
+      Region re;
+      DFA::Transition* t = re.alloc<DFA::Transition>(noOfTrans+1);
+      noOfTrans = 0;
+      for (int i=1; i<=q; i++) {
+        for (int j=1; j<=symbols; j++) {
+          int o = d->a[(i-1)*symbols+(j-1)]->getInt();
+          if (o > 0) {
+            t[noOfTrans].i_state = i;
+            t[noOfTrans].symbol  = j;
+            t[noOfTrans].o_state = o;
+            noOfTrans++;
+          }
+        }
+      }
+      t[noOfTrans].i_state = -1;
+
+      // Final states
+      AST::SetLit* sl = fn->getSet();
+      int* f;
+      if (sl->interval) {
+        f = re.alloc<int>(sl->max-sl->min+2);
+        for (int i=sl->min; i<=sl->max; i++)
+          f[i-sl->min] = i;
+        f[sl->max-sl->min+1] = -1;
+      } else {
+        f = re.alloc<int>(sl->s.size()+1);
+        for (int j=sl->s.size(); j--; )
+          f[j] = sl->s[j];
+        f[sl->s.size()] = -1;
+      }
+
+      return DFA(q0,t,f);
+    }
+
+#ifdef GECODE_HAS_THREADS
+
+    /**
+     * \brief Parallel preparation of constraints
+     *
+     * Builds the tuple sets of table constraints and the DFAs of
+     * regular constraints. As the construction does not depend on
+     * the space, it can be done by several threads. Constraints for
+     * which the construction fails are left for the sequential post,
+     * so that errors are reported as usual.
+     */
+    class Preparation {
+    public:
+      /// The constraints to be prepared
+      std::vector<const ConExpr*> ces;
+      /// The prepared tuple sets (empty if not a table constraint)
+      std::vector<TupleSet> ts;
+      /// The prepared DFAs (empty if not a regular constraint)
+      std::vector<DFA> dfa;
+      /// Whether preparation succeeded
+      std::vector<char> ok;
+      /// Mutex for access to next job and number of running workers
+      Support::Mutex m;
+      /// The next constraint to be prepared
+      unsigned int next;
+      /// Number of running workers
+      unsigned int running;
+      /// Event signalled when the last worker terminates
+      Support::Event done;
+      /// Return whether \a ce is a table constraint (on Booleans if \a b)
+      static bool table(const ConExpr& ce, bool& b) {
+        if (ce.id.compare(0,16,"gecode_table_int") == 0) {
+          b = false; return true;
+        }
+        if (ce.id.compare(0,17,"gecode_table_bool") == 0) {
+          b = true; return true;
+        }
+        return false;
+      }
+      /// Return whether \a ce is a regular constraint
+      static bool regular(const ConExpr& ce) {
+        return ce.id == "gecode_regular";
+      }
+      /// Initialize for constraints \a ces0
+      Preparation(const std::vector<ConExpr*>& ces0) : next(0), running(0) {
+        for (unsigned int i=0; i<ces0.size(); i++) {
+          bool b;
+          if (table(*ces0[i],b) || regular(*ces0[i]))
+            ces.push_back(ces0[i]);
+        }
+        ts.resize(ces.size());
+        dfa.resize(ces.size());
+        ok.resize(ces.size(),0);
+      }
+      /// Prepare constraint \a i
+      void prepare(unsigned int i) {
+        const ConExpr& ce = *ces[i];
+        try {
+          bool b;
+          if (table(ce,b)) {
+            ts[i] = buildTupleSet(ce[1], ce[0]->getArray()->a.size(), b);
+          } else {
+            dfa[i] = buildDFA(ce[1],ce[2],ce[3],ce[4],ce[5]);
+          }
+          ok[i] = 1;
+        } catch (...) {
+          // Left to the sequential post
+        }
+      }
+      /// Prepare constraints until none is left
+      void work(void) {
+        while (true) {
+          m.acquire();
+          unsigned int i = next++;
+          m.release();
+          if (i >= ces.size())
+            return;
+          prepare(i);
+        }
+      }
+    };
+
+    /// Worker thread for preparing constraints
+    class PrepareWorker : public Support::Runnable {
+    protected:
+      /// The preparation the worker takes part in
+      Preparation& p;
+    public:
+      /// Initialize
+      PrepareWorker(Preparation& p0) : p(p0) {}
+      /// Prepare constraints and signal termination
+      virtual void run(void) {
+        p.work();
+        p.m.acquire();
+        bool last = (--p.running == 0);
+        p.m.release();
+        if (last)
+          p.done.signal();
+      }
+    };
+
+#endif
+
+  }
+
+  void
+  FlatZincSpace::prepareThreads(unsigned int n) {
+    if (_initData)
+      _initData->prepareThreads = (n == 0) ? Support::Thread::npu() : n;
+  }
+
   void
   FlatZincSpace::postConstraints(std::vector<ConExpr*>& ces) {
     ConExprOrder ceo;
     std::sort(ces.begin(), ces.end(), ceo);
 
+#ifdef GECODE_HAS_THREADS
+    if ((_initData != NULL) && (_initData->prepareThreads > 1)) {
+      Preparation p(ces);
+      if (p.ces.size() > 1) {
+        unsigned int n = std::min(_initData->prepareThreads,
+                                  static_cast<unsigned int>(p.ces.size()));
+        // The calling thread is one of the workers
+        p.running = n-1;
+        for (unsigned int i=1; i<n; i++)
+          Support::Thread::run(new PrepareWorker(p));
+        p.work();
+        p.done.wait();
+      }
+      for (unsigned int i=0; i<p.ces.size(); i++)
+        if (p.ok[i]) {
+          if (Preparation::regular(*p.ces[i]))
+            _initData->preparedDFAs[(*p.ces[i])[3]] = p.dfa[i];
+          else
+            _initData->preparedTupleSets[(*p.ces[i])[1]] = p.ts[i];
+        }
+    }
+#endif
+
     for (unsigned int i=0; i<ces.size(); i++) {
       const ConExpr& ce = *ces[i];
       try {
@@ -1017,6 +1231,10 @@ namespace Gecode { namespace FlatZinc {
       delete ces[i];
       ces[i] = NULL;
     }
+    if (_initData != NULL) {
+      _initData->preparedTupleSets.clear();
+      _initData->preparedDFAs.clear();
+    }
   }
 
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
@@ -1727,11 +1945,124 @@ namespace Gecode { namespace FlatZinc {
 
 #endif
 
+  /*
+   * Portfolio search
+   *
+   */
+
+  /// Configuration of a portfolio asset
+  class PortfolioAsset {
+  public:
+    /// Variable selection
+    enum VarSel {
+      VS_AFC,    ///< Select by largest accumulated failure count by size
+      VS_CHB,    ///< Select by largest CHB Q-score by size
+      VS_ACTION, ///< Select by largest action by size
+      VS_NONE,   ///< Select first unassigned variable
+      VS_RND     ///< Select randomly
+    };
+    /// Variable selection
+    VarSel vs;
+    /// Whether to select values randomly (otherwise smallest value)
+    bool rnd;
+    /// Restart mode
+    RestartMode rm;
+    /// Return configuration for asset \a a (must be larger than zero)
+    static PortfolioAsset asset(unsigned int a);
+  };
+
+  PortfolioAsset
+  PortfolioAsset::asset(unsigned int a) {
+    static const PortfolioAsset pa[] = {
+      {VS_AFC,    false, RM_NONE},
+      {VS_CHB,    false, RM_LUBY},
+      {VS_ACTION, false, RM_LUBY},
+      {VS_NONE,   false, RM_NONE},
+      {VS_RND,    true,  RM_GEOMETRIC},
+      {VS_AFC,    true,  RM_GEOMETRIC}
+    };
+    assert(a > 0);
+    return pa[(a-1) % (sizeof(pa) / sizeof(PortfolioAsset))];
+  }
+
+  /// Engine builder for a portfolio asset (restart-based if a cutoff is given)
+  template<class T, template<class> class E>
+  class PortfolioBuilder : public Search::Builder {
+  public:
+    /// Initialize with options \a o
+    PortfolioBuilder(const Search::Options& o)
+      : Search::Builder(o,E<T>::best) {}
+    /// Build engine for space \a s
+    virtual Search::Engine* operator() (Space* s) const {
+      if (opt.cutoff != NULL)
+        return Search::build<T,RBS<T,E> >(s,opt);
+      return Search::build<T,E>(s,opt);
+    }
+  };
+
+  /// Engine builders for all portfolio assets
+  template<class T, template<class> class E>
+  class PortfolioBuilders {
+  protected:
+    /// The builders
+    SEBs sebs;
+    /// Create builders for \a o.assets assets
+    PortfolioBuilders(const Search::Options& o);
+  };
+
+  template<class T, template<class> class E>
+  PortfolioBuilders<T,E>::PortfolioBuilders(const Search::Options& o)
+    : sebs(static_cast<int>(o.assets)) {
+    Search::Options e(o.expand());
+    for (int i=0; i<sebs.size(); i++) {
+      Search::Options a(e);
+      a.threads = std::max(floor(e.threads /
+                                 static_cast<double>(sebs.size())),1.0);
+      if (i == 0) {
+        // Asset 0 follows the restart policy requested by the user
+        a.cutoff = o.cutoff;
+      } else {
+        switch (PortfolioAsset::asset(i).rm) {
+        case RM_LUBY:
+          a.cutoff = Search::Cutoff::luby(Search::Config::slice);
+          break;
+        case RM_GEOMETRIC:
+          a.cutoff = Search::Cutoff::geometric(Search::Config::slice,
+                                               Search::Config::base);
+          break;
+        default:
+          a.cutoff = NULL;
+          break;
+        }
+      }
+      sebs[i] = new PortfolioBuilder<T,E>(a);
+    }
+  }
+
+  /**
+   * \brief Portfolio of diverse search engines
+   *
+   * Asset 0 runs the search defined by the solve annotations, all
+   * other assets use different branching heuristics and restart
+   * policies (see PortfolioAsset and FlatZincSpace::slave). For best
+   * solution search, each solution found by an asset constrains all
+   * other assets.
+   */
+  template<class T, template<class> class E>
+  class Portfolio : private PortfolioBuilders<T,E>, public PBS<T,E> {
+  public:
+    /// Initialize with \a o.assets assets running copies of \a s
+    Portfolio(T* s, const Search::Options& o)
+      : PortfolioBuilders<T,E>(o), PBS<T,E>(s,this->sebs,o) {}
+  };
+
   template<template<class> class Engine>
   void
   FlatZincSpace::runEngine(std::ostream& out, const Printer& p,
                            const FlatZincOptions& opt, Support::Timer& t_total) {
-    if (opt.restart()==RM_NONE) {
+    if (opt.assets() > 0) {
+      runMeta<Engine,Portfolio>(out,p,opt,t_total);
+    } else if (opt.restart()==RM_NONE) {
       runMeta<Engine,Driver::EngineToMeta>(out,p,opt,t_total);
     } else {
       runMeta<Engine,RBS>(out,p,opt,t_total);
@@ -1828,6 +2159,15 @@ namespace Gecode { namespace FlatZinc {
       return;
     }
 #endif
+    Profiler* pr = NULL;
+    if ((opt.mode() == SM_STAT) && opt.profile()) {
+      pr = new Profiler;
+      try {
+        trace(*this, TE_PROPAGATE, *pr);
+      } catch (MoreThanOneTracer&) {
+        delete pr; pr = NULL;
+      }
+    }
     StatusStatistics sstat;
     unsigned int n_p = 0;
     Support::Timer t_solve;
@@ -1858,8 +2198,14 @@ namespace Gecode { namespace FlatZinc {
     step = opt.step();
 #endif
     o.threads = opt.threads();
+    o.affinity = opt.affinity();
+    o.parallel = opt.parallel();
+    o.replay = opt.replay();
     o.nogoods_limit = opt.nogoods() ? opt.nogoods_limit() : 0;
-    o.cutoff  = new Search::CutoffAppend(new Search::CutoffConstant(0), 1, Driver::createCutoff(opt));
+    o.assets = opt.assets();
+    o.slice = opt.slice();
+    if (opt.restart() != RM_NONE)
+      o.cutoff  = new Search::CutoffAppend(new Search::CutoffConstant(0), 1, Driver::createCutoff(opt));
     if (opt.interrupt())
       Driver::CombinedStop::installCtrlHandler(true);
     {
@@ -1920,10 +2266,15 @@ namespace Gecode { namespace FlatZinc {
             << "%%%mzn-stat peakDepth=" << stat.depth << std::endl
             << "%%%mzn-stat-end" << std::endl
             << std::endl;
+        if (pr != NULL) {
+          pr->print(out, "% ");
+          out << std::endl;
+        }
       }
     }
     delete o.stop;
     delete o.tracer;
+    delete pr;
   }
 
 #ifdef GECODE_HAS_QT
@@ -2000,6 +2351,57 @@ namespace Gecode { namespace FlatZinc {
 
   bool
   FlatZincSpace::slave(const MetaInfo& mi) {
+    if ((mi.type() == MetaInfo::PORTFOLIO) && (mi.asset() > 0)) {
+      // Replace the branchers by the asset's branching
+      PortfolioAsset pa(PortfolioAsset::asset(mi.asset()));
+      Rnd r(_random(1U << 24) + mi.asset());
+      BrancherGroup::all.kill(*this);
+      IntValBranch ivb = pa.rnd ? INT_VAL_RND(r) : INT_VAL_MIN();
+      BoolValBranch bvb = pa.rnd ? BOOL_VAL_RND(r) : BOOL_VAL_MIN();
+      switch (pa.vs) {
+      case PortfolioAsset::VS_AFC:
+        if (iv.size() > 0)
+          branch(*this, iv, INT_VAR_AFC_SIZE_MAX(0.99), ivb);
+        if (bv.size() > 0)
+          branch(*this, bv, BOOL_VAR_AFC_MAX(0.99), bvb);
+        break;
+      case PortfolioAsset::VS_CHB:
+        if (iv.size() > 0)
+          branch(*this, iv, INT_VAR_CHB_SIZE_MAX(), ivb);
+        if (bv.size() > 0)
+          branch(*this, bv, BOOL_VAR_CHB_MAX(), bvb);
+        break;
+      case PortfolioAsset::VS_ACTION:
+        if (iv.size() > 0)
+          branch(*this, iv, INT_VAR_ACTION_SIZE_MAX(0.99), ivb);
+        if (bv.size() > 0)
+          branch(*this, bv, BOOL_VAR_ACTION_MAX(0.99), bvb);
+        break;
+      case PortfolioAsset::VS_NONE:
+        if (iv.size() > 0)
+          branch(*this, iv, INT_VAR_NONE(), ivb);
+        if (bv.size() > 0)
+          branch(*this, bv, BOOL_VAR_NONE(), bvb);
+        break;
+      case PortfolioAsset::VS_RND:
+        if (iv.size() > 0)
+          branch(*this, iv, INT_VAR_RND(r), ivb);
+        if (bv.size() > 0)
+          branch(*this, bv, BOOL_VAR_RND(r), bvb);
+        break;
+      default:
+        GECODE_NEVER;
+      }
+#ifdef GECODE_HAS_SET_VARS
+      if (sv.size() > 0)
+        branch(*this, sv, SET_VAR_AFC_SIZE_MAX(0.99), SET_VAL_MIN_INC());
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      if (fv.size() > 0)
+        branch(*this, fv, FLOAT_VAR_SIZE_MIN(), FLOAT_VAL_SPLIT_MIN());
+#endif
+      return true;
+    }
     if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
         (_lns > 0) && (mi.last()==NULL) && (_lnsInitialSolution.size()>0)) {
       for (unsigned int i=iv_lns.size(); i--;) {
@@ -2143,7 +2545,24 @@ namespace Gecode { namespace FlatZinc {
       ts.add(t);
     }
     ts.finalize();
-
+    return getSharedTupleSet(ts);
+  }
+  TupleSet
+  FlatZincSpace::arg2tupleset(AST::Node* arg, int noOfVars, bool b) {
+    if (_initData) {
+      std::unordered_map<AST::Node*,TupleSet>::iterator it =
+        _initData->preparedTupleSets.find(arg);
+      if (it != _initData->preparedTupleSets.end()) {
+        TupleSet ts = it->second;
+        _initData->preparedTupleSets.erase(it);
+        return getSharedTupleSet(ts);
+      }
+    }
+    TupleSet ts = buildTupleSet(arg, noOfVars, b);
+    return getSharedTupleSet(ts);
+  }
+  TupleSet
+  FlatZincSpace::getSharedTupleSet(TupleSet& ts) {
     if (_initData) {
       FlatZincSpaceInitData::TupleSetSet::iterator it = _initData->tupleSetSet.find(ts);
       if (it != _initData->tupleSetSet.end()) {
@@ -2151,8 +2570,6 @@ namespace Gecode { namespace FlatZinc {
       }
       _initData->tupleSetSet.insert(ts);
     }
-    
-    
     return ts;
   }
   IntSharedArray
@@ -2410,6 +2827,22 @@ namespace Gecode { namespace FlatZinc {
     return a;
   }
 
+  DFA
+  FlatZincSpace::arg2dfa(AST::Node* q, AST::Node* s, AST::Node* d,
+                         AST::Node* q0, AST::Node* f) {
+    if (_initData) {
+      std::unordered_map<AST::Node*,DFA>::iterator it =
+        _initData->preparedDFAs.find(d);
+      if (it != _initData->preparedDFAs.end()) {
+        DFA dfa = it->second;
+        _initData->preparedDFAs.erase(it);
+        return getSharedDFA(dfa);
+      }
+    }
+    DFA dfa = buildDFA(q, s, d, q0, f);
+    return getSharedDFA(dfa);
+  }
+
   void
   Printer::init(AST::Array* output) {
     _output = output;
@@ -186,12 +186,12 @@ namespace Gecode { namespace FlatZinc {
     ParserState(const std::string& b, std::ostream& err0,
                 Gecode::FlatZinc::FlatZincSpace* fg0)
     : buf(b.c_str()), pos(0), length(b.size()), fg(fg0),
-      hadError(false), err(err0) {}
+      stream(false), initialized(false), hadError(false), err(err0) {}
 
     ParserState(char* buf0, int length0, std::ostream& err0,
                 Gecode::FlatZinc::FlatZincSpace* fg0)
     : buf(buf0), pos(0), length(length0), fg(fg0),
-      hadError(false), err(err0) {}
+      stream(false), initialized(false), hadError(false), err(err0) {}
 
     void* yyscanner;
     const char* buf;
@@ -212,6 +212,11 @@ namespace Gecode { namespace FlatZinc {
 
     std::vector<ConExpr*> domainConstraints;
 
+    /// Whether constraints are posted as soon as they are parsed
+    bool stream;
+    /// Whether the variables have been created
+    bool initialized;
+
     bool hadError;
     std::ostream& err;
 
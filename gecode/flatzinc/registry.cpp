@@ -1032,53 +1032,9 @@ namespace Gecode { namespace FlatZinc {
 
     void p_regular(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs iv = s.arg2intvarargs(ce[0]);
-      int q = ce[1]->getInt();
-      int symbols = ce[2]->getInt();
-      IntArgs d = s.arg2intargs(ce[3]);
-      int q0 = ce[4]->getInt();
-
-      int noOfTrans = 0;
-      for (int i=1; i<=q; i++) {
-        for (int j=1; j<=symbols; j++) {
-          if (d[(i-1)*symbols+(j-1)] > 0)
-            noOfTrans++;
-        }
-      }
-
-      Region re;
-      DFA::Transition* t = re.alloc<DFA::Transition>(noOfTrans+1);
-      noOfTrans = 0;
-      for (int i=1; i<=q; i++) {
-        for (int j=1; j<=symbols; j++) {
-          if (d[(i-1)*symbols+(j-1)] > 0) {
-            t[noOfTrans].i_state = i;
-            t[noOfTrans].symbol  = j;
-            t[noOfTrans].o_state = d[(i-1)*symbols+(j-1)];
-            noOfTrans++;
-          }
-        }
-      }
-      t[noOfTrans].i_state = -1;
-
-      // Final states
-      AST::SetLit* sl = ce[5]->getSet();
-      int* f;
-      if (sl->interval) {
-        f = static_cast<int*>(heap.ralloc(sizeof(int)*(sl->max-sl->min+2)));
-        for (int i=sl->min; i<=sl->max; i++)
-          f[i-sl->min] = i;
-        f[sl->max-sl->min+1] = -1;
-      } else {
-        f = static_cast<int*>(heap.ralloc(sizeof(int)*(sl->s.size()+1)));
-        for (int j=sl->s.size(); j--; )
-          f[j] = sl->s[j];
-        f[sl->s.size()] = -1;
-      }
-
-      DFA dfa(q0,t,f);
-      free(f);
+      DFA dfa = s.arg2dfa(ce[1],ce[2],ce[3],ce[4],ce[5]);
       unshare(s, iv);
-      extensional(s, iv, s.getSharedDFA(dfa), s.ann2ipl(ann));
+      extensional(s, iv, dfa, s.ann2ipl(ann));
     }
 
     void
@@ -1136,48 +1092,42 @@ namespace Gecode { namespace FlatZinc {
     void
     p_table_int(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,s.ann2ipl(ann));
     }
 
     void
     p_table_int_reif(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_EQV),s.ann2ipl(ann));
     }
 
     void
     p_table_int_imp(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_IMP),s.ann2ipl(ann));
     }
     
     void
     p_table_bool(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size(),true);
       extensional(s,x,ts,s.ann2ipl(ann));
     }
 
     void
     p_table_bool_reif(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size(),true);
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_EQV),s.ann2ipl(ann));
     }
 
     void
     p_table_bool_imp(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size(),true);
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_IMP),s.ann2ipl(ann));
     }
 
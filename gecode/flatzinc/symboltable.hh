@@ -35,61 +35,189 @@
 #define __GECODE_FLATZINC_SYMBOLTABLE_HH__
 
 #include <vector>
-
-#ifdef GECODE_HAS_UNORDERED_MAP
-#include <unordered_map>
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-#include <ext/hash_map>
-#else
-#include <map>
-#endif
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <new>
 
 namespace Gecode { namespace FlatZinc {
 
-  /// Symbol table mapping identifiers (strings) to values
+  /**
+   * \brief Symbol table mapping identifiers (strings) to values
+   *
+   * The table uses open addressing with linear probing. Identifiers
+   * are interned: their characters are copied once into large blocks
+   * that are owned by the table, so that neither insertion nor lookup
+   * allocates memory per identifier.
+   */
   template<class Val>
   class SymbolTable {
   private:
-#ifdef GECODE_HAS_UNORDERED_MAP
-    typedef std::unordered_map<std::string,Val> mymap;
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-    class hashString {
+    /// Entry of the table
+    class Entry {
     public:
-      size_t operator ()(const std::string& x) const {
-        return __gnu_cxx::hash<const char*>()(x.c_str());
-      }
+      /// Interned key (NULL if entry is empty)
+      const char* key;
+      /// Length of key
+      size_t n;
+      /// Hash value of key
+      size_t h;
+      /// Value
+      Val val;
     };
-    typedef __gnu_cxx::hash_map<std::string,Val,hashString> mymap;
-#else
-    typedef std::map<std::string,Val> mymap;
-#endif
-    mymap m;
+    /// The entries (number is a power of two)
+    std::vector<Entry> e;
+    /// Number of used entries
+    size_t n_e;
+    /// Blocks of interned characters
+    std::vector<char*> b;
+    /// Next free character in current block
+    char* f;
+    /// Number of free characters in current block
+    size_t n_f;
+    /// Minimal size of a block of characters
+    static const size_t block_size = 64*1024;
+    /// Return hash value for key \a key of length \a n
+    static size_t hash(const char* key, size_t n);
+    /// Return copy of key \a key of length \a n owned by the table
+    const char* intern(const char* key, size_t n);
+    /// Return position of entry for \a key or of empty entry
+    size_t find(const char* key, size_t n, size_t h) const;
+    /// Double the number of entries
+    void grow(void);
+    /// Disallow copying
+    SymbolTable(const SymbolTable&);
+    /// Disallow assignment
+    SymbolTable& operator =(const SymbolTable&);
   public:
+    /// Initialize empty table
+    SymbolTable(void);
+    /// Insert \a val with \a key
+    bool put(const char* key, const Val& val);
     /// Insert \a val with \a key
     bool put(const std::string& key, const Val& val);
     /// Return whether \a key exists, and set \a val if it does exist
+    bool get(const char* key, Val& val) const;
+    /// Return whether \a key exists, and set \a val if it does exist
     bool get(const std::string& key, Val& val) const;
+    /// Destructor
+    ~SymbolTable(void);
   };
 
   template<class Val>
-  bool
+  inline
+  SymbolTable<Val>::SymbolTable(void)
+    : e(1024), n_e(0), f(NULL), n_f(0) {
+    for (size_t i=0; i<e.size(); i++)
+      e[i].key = NULL;
+  }
+
+  template<class Val>
+  inline
+  SymbolTable<Val>::~SymbolTable(void) {
+    for (size_t i=0; i<b.size(); i++)
+      free(b[i]);
+  }
+
+  template<class Val>
+  forceinline size_t
+  SymbolTable<Val>::hash(const char* key, size_t n) {
+    // FNV-1a (the table uses the low bits, so mix in the high bits)
+    size_t h = static_cast<size_t>(2166136261U);
+    for (size_t i=0; i<n; i++) {
+      h ^= static_cast<unsigned char>(key[i]);
+      h *= static_cast<size_t>(16777619U);
+    }
+    return h ^ (h >> 15) ^ (h >> 27);
+  }
+
+  template<class Val>
+  inline const char*
+  SymbolTable<Val>::intern(const char* key, size_t n) {
+    if (n+1 > n_f) {
+      n_f = std::max(n+1,block_size);
+      f = static_cast<char*>(malloc(n_f));
+      if (f == NULL)
+        throw std::bad_alloc();
+      b.push_back(f);
+    }
+    char* k = f;
+    memcpy(k,key,n); k[n] = 0;
+    f += n+1; n_f -= n+1;
+    return k;
+  }
+
+  template<class Val>
+  forceinline size_t
+  SymbolTable<Val>::find(const char* key, size_t n, size_t h) const {
+    size_t m = e.size() - 1;
+    size_t i = h & m;
+    while ((e[i].key != NULL) &&
+           ((e[i].h != h) || (e[i].n != n) || (memcmp(e[i].key,key,n) != 0)))
+      i = (i+1) & m;
+    return i;
+  }
+
+  template<class Val>
+  inline void
+  SymbolTable<Val>::grow(void) {
+    std::vector<Entry> o(2*e.size());
+    for (size_t i=0; i<o.size(); i++)
+      o[i].key = NULL;
+    o.swap(e);
+    size_t m = e.size() - 1;
+    for (size_t j=0; j<o.size(); j++)
+      if (o[j].key != NULL) {
+        size_t i = o[j].h & m;
+        while (e[i].key != NULL)
+          i = (i+1) & m;
+        e[i] = o[j];
+      }
+  }
+
+  template<class Val>
+  inline bool
+  SymbolTable<Val>::put(const char* key, const Val& val) {
+    size_t n = strlen(key);
+    size_t h = hash(key,n);
+    size_t i = find(key,n,h);
+    if (e[i].key != NULL) {
+      e[i].val = val;
+      return false;
+    }
+    // Keep the load factor below one half
+    if (2*(n_e+1) > e.size()) {
+      grow(); i = find(key,n,h);
+    }
+    e[i].key = intern(key,n); e[i].n = n; e[i].h = h; e[i].val = val;
+    n_e++;
+    return true;
+  }
+
+  template<class Val>
+  forceinline bool
   SymbolTable<Val>::put(const std::string& key, const Val& val) {
-    typename mymap::const_iterator i = m.find(key);
-    bool fresh = (i == m.end());
-    m[key] = val;
-    return fresh;
+    return put(key.c_str(),val);
   }
 
   template<class Val>
-  bool
-  SymbolTable<Val>::get(const std::string& key, Val& val) const {
-    typename mymap::const_iterator i = m.find(key);
-    if (i == m.end())
+  forceinline bool
+  SymbolTable<Val>::get(const char* key, Val& val) const {
+    size_t n = strlen(key);
+    size_t i = find(key,n,hash(key,n));
+    if (e[i].key == NULL)
       return false;
-    val = i->second;
+    val = e[i].val;
     return true;
   }
 
+  template<class Val>
+  forceinline bool
+  SymbolTable<Val>::get(const std::string& key, Val& val) const {
+    return get(key.c_str(),val);
+  }
+
 }}
 #endif
 
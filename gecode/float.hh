@@ -125,10 +125,28 @@ namespace Gecode {
 
 #include <gecode/float/num.hpp>
 
+#include <gecode/float/error-free.hpp>
+
 namespace Gecode { namespace Float {
 
 
-#if defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP > 0)))
+#if !defined(GECODE_FLOAT_HARDWARE_ROUNDING) && \
+  defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0) && \
+  !(defined(_MSC_VER) && (_MSC_VER < 1800))
+
+  /*
+   * This is used whenever floating point operations are evaluated
+   * in the precision of their type. The rounding mode of the floating
+   * point unit is never changed. Defining GECODE_FLOAT_HARDWARE_ROUNDING
+   * selects the rounding policies below instead.
+   *
+   */
+#define GECODE_FLOAT_ERROR_FREE_ROUNDING
+
+  /// Rounding Base class (error-free version)
+  typedef RoundingErrorFree RoundingBase;
+
+#elif defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP > 0)))
 
   /*
    * This is used for the MSVC compiler for x64 or x86 with SSE enabled.
@@ -413,7 +431,11 @@ namespace Gecode {
     friend FloatVal Float::hull(const FloatNum& x, const FloatNum& y);
   protected:
     /// Used rounding policies
+#ifdef GECODE_FLOAT_ERROR_FREE_ROUNDING
+    typedef gecode_boost::numeric::interval_lib::save_state_nothing<Float::Rounding> R;
+#else
     typedef gecode_boost::numeric::interval_lib::save_state<Float::Rounding> R;
+#endif
     /// Used checking policy
     typedef gecode_boost::numeric::interval_lib::checking_strict<FloatNum> P;
     /// Implementation type for float value
@@ -0,0 +1,257 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Gecode { namespace Float {
+
+  /**
+   * \brief Directed rounding based on error-free transformations
+   *
+   * All operations are performed in the default round-to-nearest
+   * mode. The exact rounding error of an operation is computed by an
+   * error-free transformation (two-sum for addition and subtraction,
+   * fused multiply-add for multiplication, division, and square root)
+   * and the result is moved to the next floating point number in the
+   * direction of rounding if required. Hence, the rounding mode of
+   * the floating point unit is never changed.
+   *
+   * Whenever the rounding error cannot be represented (due to
+   * underflow) the result is rounded conservatively.
+   *
+   * Requires that floating point operations are evaluated in the
+   * precision of their type (that is, \c FLT_EVAL_METHOD is zero).
+   *
+   * \ingroup TaskModelFloatVars
+   */
+  class RoundingErrorFree {
+  protected:
+    /// Smallest magnitude for which errors of products are representable
+    static FloatNum tiny(void);
+    /// Return next floating point number above \a x
+    static FloatNum next_up(FloatNum x);
+    /// Return next floating point number below \a x
+    static FloatNum next_down(FloatNum x);
+  public:
+    /// Rounding mode (not used)
+    typedef int rounding_mode;
+    /// Initialize (nothing to do)
+    void init(void);
+    /// Return lower bound of conversion of \a x
+    FloatNum conv_down(FloatNum x);
+    /// Return upper bound of conversion of \a x
+    FloatNum conv_up(FloatNum x);
+    /// Return lower bound of \a x plus \a y
+    FloatNum add_down(FloatNum x, FloatNum y);
+    /// Return upper bound of \a x plus \a y
+    FloatNum add_up(FloatNum x, FloatNum y);
+    /// Return lower bound of \a x minus \a y
+    FloatNum sub_down(FloatNum x, FloatNum y);
+    /// Return upper bound of \a x minus \a y
+    FloatNum sub_up(FloatNum x, FloatNum y);
+    /// Return lower bound of \a x times \a y
+    FloatNum mul_down(FloatNum x, FloatNum y);
+    /// Return upper bound of \a x times \a y
+    FloatNum mul_up(FloatNum x, FloatNum y);
+    /// Return lower bound of \a x divided by \a y
+    FloatNum div_down(FloatNum x, FloatNum y);
+    /// Return upper bound of \a x divided by \a y
+    FloatNum div_up(FloatNum x, FloatNum y);
+    /// Return lower bound of square root of \a x
+    FloatNum sqrt_down(FloatNum x);
+    /// Return upper bound of square root of \a x
+    FloatNum sqrt_up(FloatNum x);
+    /// Return median of \a x and \a y
+    FloatNum median(FloatNum x, FloatNum y);
+    /// Return next downward-rounded integer of \a x
+    FloatNum int_down(FloatNum x);
+    /// Return next upward-rounded integer of \a x
+    FloatNum int_up(FloatNum x);
+  };
+
+
+  forceinline FloatNum
+  RoundingErrorFree::tiny(void) {
+    // 2^-969: below, the error of a product might underflow
+    return DBL_MIN * 9007199254740992.0;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::next_up(FloatNum x) {
+    if (!(x < std::numeric_limits<FloatNum>::infinity()))
+      return x;
+    if (x == 0.0)
+      return std::numeric_limits<FloatNum>::denorm_min();
+    unsigned long long int b;
+    memcpy(&b,&x,sizeof(b));
+    if (x > 0.0) b++; else b--;
+    memcpy(&x,&b,sizeof(b));
+    return x;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::next_down(FloatNum x) {
+    return -next_up(-x);
+  }
+
+  forceinline void
+  RoundingErrorFree::init(void) {}
+
+  forceinline FloatNum
+  RoundingErrorFree::conv_down(FloatNum x) {
+    return x;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::conv_up(FloatNum x) {
+    return x;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::add_down(FloatNum x, FloatNum y) {
+    FloatNum s = x + y;
+    // Two-sum: s + e = x + y exactly
+    FloatNum z = s - x;
+    FloatNum e = (x - (s - z)) + (y - z);
+    if (e < 0.0)
+      return next_down(s);
+    // The error is not a number only if the sum overflows
+    if ((e != e) && (s == std::numeric_limits<FloatNum>::infinity()) &&
+        (x != s) && (y != s))
+      return std::numeric_limits<FloatNum>::max();
+    return s;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::add_up(FloatNum x, FloatNum y) {
+    FloatNum s = x + y;
+    // Two-sum: s + e = x + y exactly
+    FloatNum z = s - x;
+    FloatNum e = (x - (s - z)) + (y - z);
+    if (e > 0.0)
+      return next_up(s);
+    // The error is not a number only if the sum overflows
+    if ((e != e) && (s == -std::numeric_limits<FloatNum>::infinity()) &&
+        (x != s) && (y != s))
+      return -std::numeric_limits<FloatNum>::max();
+    return s;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::sub_down(FloatNum x, FloatNum y) {
+    return add_down(x,-y);
+  }
+  forceinline FloatNum
+  RoundingErrorFree::sub_up(FloatNum x, FloatNum y) {
+    return add_up(x,-y);
+  }
+
+  /*
+   * For multiplication, division, and square root the error is
+   * computed by a fused multiply-add. As the rounded error has the
+   * same sign as the exact error or is zero, only a zero error for a
+   * tiny result is not trustworthy. Overflow yields an infinite
+   * error with the right sign.
+   *
+   */
+
+  forceinline FloatNum
+  RoundingErrorFree::mul_down(FloatNum x, FloatNum y) {
+    FloatNum p = x * y;
+    FloatNum e = std::fma(x,y,-p);
+    if ((e < 0.0) ||
+        ((e == 0.0) && (std::fabs(p) < tiny()) && (x != 0.0) && (y != 0.0)))
+      return next_down(p);
+    return p;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::mul_up(FloatNum x, FloatNum y) {
+    FloatNum p = x * y;
+    FloatNum e = std::fma(x,y,-p);
+    if ((e > 0.0) ||
+        ((e == 0.0) && (std::fabs(p) < tiny()) && (x != 0.0) && (y != 0.0)))
+      return next_up(p);
+    return p;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::div_down(FloatNum x, FloatNum y) {
+    FloatNum q = x / y;
+    // x / y - q has the sign of r / y
+    FloatNum r = std::fma(-q,y,x);
+    if (((y > 0.0) ? (r < 0.0) : (r > 0.0)) ||
+        ((r == 0.0) && (x != 0.0) &&
+         ((std::fabs(x) < tiny()) || (std::fabs(q) < tiny()))))
+      return next_down(q);
+    return q;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::div_up(FloatNum x, FloatNum y) {
+    FloatNum q = x / y;
+    // x / y - q has the sign of r / y
+    FloatNum r = std::fma(-q,y,x);
+    if (((y > 0.0) ? (r > 0.0) : (r < 0.0)) ||
+        ((r == 0.0) && (x != 0.0) &&
+         ((std::fabs(x) < tiny()) || (std::fabs(q) < tiny()))))
+      return next_up(q);
+    return q;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::sqrt_down(FloatNum x) {
+    FloatNum s = std::sqrt(x);
+    // sqrt(x) - s has the sign of x - s * s
+    FloatNum e = std::fma(-s,s,x);
+    if ((e < 0.0) || ((e == 0.0) && (x > 0.0) && (x < tiny())))
+      return next_down(s);
+    return s;
+  }
+  forceinline FloatNum
+  RoundingErrorFree::sqrt_up(FloatNum x) {
+    FloatNum s = std::sqrt(x);
+    // sqrt(x) - s has the sign of x - s * s
+    FloatNum e = std::fma(-s,s,x);
+    if ((e > 0.0) || ((e == 0.0) && (x > 0.0) && (x < tiny())))
+      return next_up(s);
+    return s;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::median(FloatNum x, FloatNum y) {
+    return (x + y) / 2.0;
+  }
+
+  forceinline FloatNum
+  RoundingErrorFree::int_down(FloatNum x) {
+    return std::floor(x);
+  }
+  forceinline FloatNum
+  RoundingErrorFree::int_up(FloatNum x) {
+    return std::ceil(x);
+  }
+
+}}
+
+// STATISTICS: float-var
@@ -1394,6 +1394,27 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post domain consistent propagator for a conjunction of Boolean clauses
+   *
+   * The array \a c contains the clauses over the variables \a x, where
+   * each clause is a sequence of literals terminated by 0 (the
+   * terminating 0 of the last clause can be omitted). The literal
+   * \f$i>0\f$ refers to \f$x_{i-1}\f$ and the literal \f$-i\f$ to
+   * \f$\neg x_{i-1}\f$. This corresponds to the clauses of a file
+   * in DIMACS CNF format.
+   *
+   * All clauses are propagated by a single propagator that stores the
+   * literals in a single array which is shared among all clones. For
+   * models with many clauses this requires considerably less memory
+   * and cloning time than posting each clause with clause().
+   *
+   * Throws an exception of type Int::OutOfLimits, if a literal
+   * refers to a variable that is not in \a x.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& c,
+          IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
@@ -2253,6 +2274,10 @@ namespace Gecode {
       Range* range;
       /// Pointer to all support data
       BitSetData* support;
+      /// Memory mapping holding tuple and support data (or nullptr)
+      void* mm;
+      /// Size of memory mapping
+      std::size_t n_mm;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2313,6 +2338,19 @@ namespace Gecode {
     /// Initialize with DFA \a dfa for arity \a a
     GECODE_INT_EXPORT
     TupleSet(int a, const DFA& dfa);
+    /**
+     * \brief Initialize from file \a fn written by TupleSet::save
+     *
+     * The tuple set is finalized. Where supported, the file is
+     * mapped read-only into memory and the tuples and supports are
+     * used in place without copying.
+     *
+     * Throws an exception of type Int::IllegalTupleSetFile, if the
+     * file cannot be read or has not been written by TupleSet::save
+     * on a compatible platform.
+     */
+    GECODE_INT_EXPORT
+    explicit TupleSet(const char* fn);
     /// Test whether tuple set has been initialized
     operator bool(void) const;
     /// Test whether tuple set is equal to \a t
@@ -2329,6 +2367,18 @@ namespace Gecode {
     bool finalized(void) const;
     /// Finalize tuple set
     void finalize(void);
+    /**
+     * \brief Write tuple set to file \a fn
+     *
+     * The file contains the tuples together with the supports as
+     * computed by finalization and can be loaded by TupleSet(const char*).
+     *
+     * Throws an exception of type Int::NotYetFinalized, if the tuple
+     * set is not finalized and an exception of type
+     * Int::IllegalTupleSetFile, if the file cannot be written.
+     */
+    GECODE_INT_EXPORT
+    void save(const char* fn) const;
     //@}
 
     /// \name Tuple access
@@ -987,6 +987,18 @@ namespace Gecode {
     }
   }
 
+  void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& c,
+          IntPropLevel) {
+    using namespace Int;
+    for (int i=0; i<c.size(); i++)
+      if ((c[i] < -x.size()) || (c[i] > x.size()))
+        throw OutOfLimits("Int::clauses");
+    GECODE_POST;
+    ViewArray<BoolView> xv(home,x);
+    GECODE_ES_FAIL(Bool::Clauses::post(home,xv,c));
+  }
+
   void
   ite(Home home, BoolVar b, IntVar x, IntVar y, IntVar z,
       IntPropLevel ipl) {
@@ -570,6 +570,89 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Propagator for a conjunction of Boolean clauses
+   *
+   * All clauses are propagated by a single propagator using two
+   * watched literals per clause. The literals of all clauses are
+   * stored in arrays that are shared among all clones, only the
+   * watches are copied. Hence, for models with many clauses both
+   * memory and cloning time are considerably smaller than when
+   * using a propagator per clause.
+   *
+   * A literal \f$l\f$ refers to the view \f$x_{l/2}\f$ if \f$l\f$
+   * is even and to its negation otherwise.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class Clauses : public Propagator {
+  protected:
+    /// %Advisor for a view (remembers the index of the view)
+    class Idx : public Advisor {
+    public:
+      /// Index of view
+      const int i;
+      /// Create advisor for view with index \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// The views
+    ViewArray<BoolView> x;
+    /// The advisor council
+    Council<Idx> c;
+    /// Literals of all clauses (shared among clones)
+    SharedArray<int> lit;
+    /// Clause \f$i\f$ uses literals from \a fst[i] to \a fst[i+1]-1
+    SharedArray<int> fst;
+    /// Position of watched literal (two per clause)
+    int* w;
+    /// Next watch for the same literal (or -1)
+    int* nw;
+    /// First watch for a literal (or -1)
+    int* hw;
+    /// Indices of views that have been assigned but not yet processed
+    int* q;
+    /// Number of views that have been assigned but not yet processed
+    int n_q;
+    /// Constructor for posting
+    Clauses(Home home, ViewArray<BoolView>& x,
+            SharedArray<int>& lit, SharedArray<int>& fst);
+    /// Constructor for cloning \a p
+    Clauses(Space& home, Clauses& p);
+  public:
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    GECODE_INT_EXPORT
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post propagator for clauses \a cl on views \a x
+     *
+     * The array \a cl contains the clauses, each clause is a sequence
+     * of literals terminated by 0. The literal \f$i>0\f$ refers to
+     * \f$x_{i-1}\f$ and the literal \f$-i\f$ to its negation.
+     */
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           const IntArgs& cl);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief If-then-else propagator base-class
    *
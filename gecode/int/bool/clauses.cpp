@@ -0,0 +1,260 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/bool.hh>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Propagator for a conjunction of Boolean clauses
+   *
+   */
+
+  /// Test whether literal \a l on views \a x is true
+  forceinline bool
+  one(const ViewArray<BoolView>& x, int l) {
+    return ((l & 1) == 0) ? x[l >> 1].one() : x[l >> 1].zero();
+  }
+  /// Test whether literal \a l on views \a x is false
+  forceinline bool
+  zero(const ViewArray<BoolView>& x, int l) {
+    return ((l & 1) == 0) ? x[l >> 1].zero() : x[l >> 1].one();
+  }
+
+  /// Order view indices by view first and index second
+  class IdxLess {
+  public:
+    /// The views
+    const ViewArray<BoolView>& x;
+    /// Initialize with views \a x0
+    IdxLess(const ViewArray<BoolView>& x0) : x(x0) {}
+    /// Comparison
+    bool operator ()(int i, int j) const {
+      return (x[i] < x[j]) || ((x[i] == x[j]) && (i < j));
+    }
+  };
+
+  forceinline
+  Clauses::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  Clauses::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+  forceinline
+  Clauses::Clauses(Home home, ViewArray<BoolView>& x0,
+                   SharedArray<int>& lit0, SharedArray<int>& fst0)
+    : Propagator(home), x(x0), c(home), lit(lit0), fst(fst0), n_q(0) {
+    home.notice(*this,AP_DISPOSE);
+    int n_w = 2*(fst.size()-1);
+    w  = static_cast<Space&>(home).alloc<int>(n_w);
+    nw = static_cast<Space&>(home).alloc<int>(n_w);
+    hw = static_cast<Space&>(home).alloc<int>(2*x.size());
+    q  = static_cast<Space&>(home).alloc<int>(x.size());
+    for (int l=2*x.size(); l--; )
+      hw[l] = -1;
+    // Watch the first two literals of each clause
+    for (int s=0; s<n_w; s++) {
+      w[s] = fst[s >> 1] + (s & 1);
+      nw[s] = hw[lit[w[s]]]; hw[lit[w[s]]] = s;
+    }
+    // Assigned views are processed by the first propagation
+    for (int i=0; i<x.size(); i++)
+      if (x[i].assigned())
+        q[n_q++] = i;
+      else
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+    if (n_q > 0)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  forceinline
+  Clauses::Clauses(Space& home, Clauses& p)
+    : Propagator(home,p), lit(p.lit), fst(p.fst), n_q(p.n_q) {
+    x.update(home,p.x);
+    c.update(home,p.c);
+    int n_w = 2*(fst.size()-1);
+    w  = home.alloc<int>(n_w);
+    nw = home.alloc<int>(n_w);
+    hw = home.alloc<int>(2*x.size());
+    q  = home.alloc<int>(x.size());
+    Heap::copy<int>(w,p.w,static_cast<unsigned int>(n_w));
+    Heap::copy<int>(nw,p.nw,static_cast<unsigned int>(n_w));
+    Heap::copy<int>(hw,p.hw,static_cast<unsigned int>(2*x.size()));
+    Heap::copy<int>(q,p.q,static_cast<unsigned int>(n_q));
+  }
+
+  Actor*
+  Clauses::copy(Space& home) {
+    return new (home) Clauses(home,*this);
+  }
+
+  PropCost
+  Clauses::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size());
+  }
+
+  void
+  Clauses::reschedule(Space& home) {
+    if (n_q > 0)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  Clauses::advise(Space& home, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    q[n_q++] = a.i;
+    // The propagator is already scheduled or running otherwise
+    if (n_q == 1)
+      return home.ES_NOFIX_DISPOSE(c,a);
+    else
+      return home.ES_FIX_DISPOSE(c,a);
+  }
+
+  ExecStatus
+  Clauses::propagate(Space& home, const ModEventDelta&) {
+    // Views assigned during propagation are appended to q
+    for (int j=0; j<n_q; j++) {
+      int i = q[j];
+      // Literal that has become false
+      int f = (i << 1) | (x[i].one() ? 1 : 0);
+      int* p = &hw[f];
+      while (*p >= 0) {
+        int s = *p;
+        // Position of the other watched literal
+        int o = w[s ^ 1];
+        if (!one(x,lit[o])) {
+          // Find a literal that is not false and is not yet watched
+          int k = fst[s >> 1];
+          int e = fst[(s >> 1) + 1];
+          while ((k < e) && ((k == o) || zero(x,lit[k])))
+            k++;
+          if (k < e) {
+            // Move watch to the literal found
+            *p = nw[s];
+            w[s] = k; nw[s] = hw[lit[k]]; hw[lit[k]] = s;
+            continue;
+          }
+          // The other watched literal must be true
+          GECODE_ME_CHECK(x[lit[o] >> 1].eq(home,(lit[o] & 1) ^ 1));
+        }
+        p = &nw[s];
+      }
+    }
+    n_q = 0;
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  Clauses::post(Home home, ViewArray<BoolView>& x, const IntArgs& cl) {
+    Region r;
+    int n = x.size();
+    // Map each view to the index of its first occurrence
+    int* m = r.alloc<int>(n);
+    {
+      int* s = r.alloc<int>(n);
+      for (int i=0; i<n; i++)
+        s[i] = i;
+      IdxLess il(x);
+      Support::quicksort<int,IdxLess>(s,n,il);
+      for (int i=0; i<n; i++)
+        m[s[i]] = ((i > 0) && (x[s[i-1]] == x[s[i]])) ? m[s[i-1]] : s[i];
+    }
+    // Literals of all clauses and where clauses start
+    int* l = r.alloc<int>(cl.size());
+    int* f = r.alloc<int>(cl.size()+1);
+    int n_l = 0, n_c = 0;
+    // The clause in which a literal has been seen last
+    int* k = r.alloc<int>(2*n);
+    for (int i=2*n; i--; )
+      k[i] = -1;
+    for (int i=0, j=0; i<cl.size(); i++, j++) {
+      int s = n_l;
+      bool sat = false;
+      for ( ; (i < cl.size()) && (cl[i] != 0); i++) {
+        int li = (cl[i] > 0) ?
+          (m[cl[i]-1] << 1) : ((m[-cl[i]-1] << 1) | 1);
+        if (sat || (k[li] == j) || zero(x,li))
+          continue;
+        if (one(x,li) || (k[li ^ 1] == j)) {
+          sat = true;
+        } else {
+          k[li] = j; l[n_l++] = li;
+        }
+      }
+      if (sat) {
+        n_l = s;
+      } else if (n_l == s) {
+        return ES_FAILED;
+      } else if (n_l == s+1) {
+        GECODE_ME_CHECK(x[l[s] >> 1].eq(home,(l[s] & 1) ^ 1));
+        n_l = s;
+      } else {
+        f[n_c++] = s;
+      }
+    }
+    if (n_c == 0)
+      return ES_OK;
+    f[n_c] = n_l;
+    // Only keep views that occur in some clause
+    int* p = r.alloc<int>(n);
+    for (int i=n; i--; )
+      p[i] = -1;
+    int n_v = 0;
+    for (int i=0; i<n_l; i++)
+      if (p[l[i] >> 1] < 0)
+        p[l[i] >> 1] = n_v++;
+    ViewArray<BoolView> y(home,n_v);
+    for (int i=0; i<n; i++)
+      if (p[i] >= 0)
+        y[p[i]] = x[i];
+    SharedArray<int> lit(n_l);
+    for (int i=0; i<n_l; i++)
+      lit[i] = (p[l[i] >> 1] << 1) | (l[i] & 1);
+    SharedArray<int> fst(n_c+1);
+    for (int i=0; i<=n_c; i++)
+      fst[i] = f[i];
+    (void) new (home) Clauses(home,y,lit,fst);
+    return ES_OK;
+  }
+
+  size_t
+  Clauses::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    c.dispose(home);
+    lit.~SharedArray<int>();
+    fst.~SharedArray<int>();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -80,6 +80,9 @@ namespace Gecode { namespace Int {
   AlreadyFinalized::AlreadyFinalized(const char* l)
     : Exception(l,"Tuple set already finalized") {}
 
+  IllegalTupleSetFile::IllegalTupleSetFile(const char* l)
+    : Exception(l,"Illegal or inaccessible tuple set file") {}
+
   LDSBUnbranchedVariable::LDSBUnbranchedVariable(const char* l)
     : Exception(l,"Variable in symmetry not branched on") {}
 
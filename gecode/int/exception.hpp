@@ -146,6 +146,13 @@ namespace Gecode { namespace Int {
     AlreadyFinalized(const char* l);
   };
 
+  /// %Exception: Illegal or inaccessible tuple set file
+  class GECODE_INT_EXPORT IllegalTupleSetFile : public Exception {
+  public:
+    /// Initialize with location \a l
+    IllegalTupleSetFile(const char* l);
+  };
+
   /// %Exception: Variable in symmetry not branched on
   class GECODE_INT_EXPORT LDSBUnbranchedVariable : public Exception {
   public:
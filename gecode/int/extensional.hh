@@ -230,6 +230,67 @@ namespace Gecode { namespace Int { namespace Extensional {
    */
   template<unsigned int size> class TinyBitSet;
 
+  /**
+   * \brief Word-wise operations on bit sets with many words
+   *
+   * The operations combine the words \f$c_i\f$ of a bit set with
+   * the words \f$a_{x_i}\f$ (and \f$b_{x_i}\f$) of masks, where
+   * \f$x\f$ is the index array of a sparse bit set (or, if \f$x\f$
+   * is \c nullptr, \f$x_i=i\f$).
+   *
+   * The operations use AVX-512 or AVX2 instructions if the processor
+   * supports them (as detected at runtime) and scalar code otherwise.
+   */
+  class GECODE_INT_EXPORT BitSetKernel {
+  public:
+    /// Operation to be performed
+    enum Op {
+      OP_OR,    ///< \f$c_i\leftarrow c_i\lor a_{x_i}\f$
+      OP_AND,   ///< \f$c_i\leftarrow c_i\land a_{x_i}\f$
+      OP_ANDOR, ///< \f$c_i\leftarrow c_i\land(a_{x_i}\lor b_{x_i})\f$
+      OP_NAND   ///< \f$c_i\leftarrow c_i\land\lnot a_{x_i}\f$
+    };
+    /// Instruction set used
+    enum Level {
+      L_SCALAR, ///< Scalar code
+      L_AVX2,   ///< AVX2
+      L_AVX512  ///< AVX-512
+    };
+    /// Minimal number of words for which the kernels are used
+    static const unsigned int min_words = 16U;
+  protected:
+    /// Instruction set used
+    static Level l;
+  public:
+    /// Whether to use the kernels for \a n words
+    static bool use(unsigned int n);
+    /// Return instruction set used
+    static Level level(void);
+    /// Use best available instruction set if \a b, scalar code otherwise
+    static void enable(bool b);
+    /// Perform operation \a o on \a n words
+    static void run(Op o, unsigned int n, const unsigned char* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c);
+    /// Perform operation \a o on \a n words
+    static void run(Op o, unsigned int n, const unsigned short int* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c);
+    /// Perform operation \a o on \a n words
+    static void run(Op o, unsigned int n, const unsigned int* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c);
+    /// Test whether \f$c_i\land a_{x_i}\f$ is non-zero for some \f$i<n\f$
+    static bool intersects(unsigned int n, const unsigned char* x,
+                           const BitSetData* a, const BitSetData* c);
+    /// Test whether \f$c_i\land a_{x_i}\f$ is non-zero for some \f$i<n\f$
+    static bool intersects(unsigned int n, const unsigned short int* x,
+                           const BitSetData* a, const BitSetData* c);
+    /// Test whether \f$c_i\land a_{x_i}\f$ is non-zero for some \f$i<n\f$
+    static bool intersects(unsigned int n, const unsigned int* x,
+                           const BitSetData* a, const BitSetData* c);
+  };
+
   /// Bit-set
   template<class IndexType>
   class BitSet {
@@ -244,6 +305,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     BitSetData* _bits;
     /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
     void replace_and_decrease(IndexType i, BitSetData w);
+    /// Remove all words that are zero
+    void remove_zeroes(void);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
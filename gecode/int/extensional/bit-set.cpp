@@ -0,0 +1,331 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/extensional.hh>
+
+#include <cstring>
+
+/*
+ * The vectorized kernels require that a bit set word has 64 bits and
+ * that the compiler supports per-function target attributes.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define GECODE_INT_EXTENSIONAL_SIMD
+#define GECODE_TARGET_AVX2 __attribute__((target("avx2")))
+#define GECODE_TARGET_AVX512 __attribute__((target("avx512f")))
+#if defined(__GNUC__) && !defined(__clang__)
+// The AVX-512 intrinsics trigger spurious warnings with some versions
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#endif
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  namespace {
+
+    /// Scalar code for operation \a o
+    template<class IndexType>
+    forceinline void
+    scalar(BitSetKernel::Op o, unsigned int i, unsigned int n,
+           const IndexType* x,
+           const BitSetData* a, const BitSetData* b, BitSetData* c) {
+      for (; i<n; i++) {
+        unsigned int j = (x != nullptr) ? x[i] : i;
+        switch (o) {
+        case BitSetKernel::OP_OR:
+          c[i] = BitSetData::o(c[i],a[j]); break;
+        case BitSetKernel::OP_AND:
+          c[i] = BitSetData::a(c[i],a[j]); break;
+        case BitSetKernel::OP_ANDOR:
+          c[i] = BitSetData::a(c[i],BitSetData::o(a[j],b[j])); break;
+        case BitSetKernel::OP_NAND:
+          c[i] = BitSetData::a(c[i],~a[j]); break;
+        default: GECODE_NEVER;
+        }
+      }
+    }
+
+    /// Scalar code for intersection test
+    template<class IndexType>
+    forceinline bool
+    scalar(unsigned int i, unsigned int n, const IndexType* x,
+           const BitSetData* a, const BitSetData* c) {
+      for (; i<n; i++)
+        if (!BitSetData::a(c[i],a[(x != nullptr) ? x[i] : i]).none())
+          return true;
+      return false;
+    }
+
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+
+    /*
+     * AVX2: four words at a time
+     *
+     */
+
+    /// Load four indices starting at \a x
+    GECODE_TARGET_AVX2 forceinline __m256i
+    avx2_index(const unsigned char* x) {
+      int v; std::memcpy(&v,x,sizeof(v));
+      return _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(v));
+    }
+    /// Load four indices starting at \a x
+    GECODE_TARGET_AVX2 forceinline __m256i
+    avx2_index(const unsigned short int* x) {
+      return _mm256_cvtepu16_epi64
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    /// Load four indices starting at \a x
+    GECODE_TARGET_AVX2 forceinline __m256i
+    avx2_index(const unsigned int* x) {
+      return _mm256_cvtepu32_epi64
+        (_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+    }
+    /// Load the words \a a at indices \a x starting from \a i
+    template<class IndexType>
+    GECODE_TARGET_AVX2 forceinline __m256i
+    avx2_load(const IndexType* x, const BitSetData* a, unsigned int i) {
+      if (x == nullptr)
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a+i));
+      return _mm256_i64gather_epi64
+        (reinterpret_cast<const long long int*>(a), avx2_index(x+i), 8);
+    }
+
+    /// Perform operation \a o with AVX2
+    template<class IndexType>
+    GECODE_TARGET_AVX2 void
+    avx2(BitSetKernel::Op o, unsigned int n, const IndexType* x,
+         const BitSetData* a, const BitSetData* b, BitSetData* c) {
+      unsigned int i = 0U;
+      for (; i+4U <= n; i += 4U) {
+        __m256i* cp = reinterpret_cast<__m256i*>(c+i);
+        __m256i cv = _mm256_loadu_si256(cp);
+        __m256i av = avx2_load(x,a,i);
+        switch (o) {
+        case BitSetKernel::OP_OR:
+          cv = _mm256_or_si256(cv,av); break;
+        case BitSetKernel::OP_AND:
+          cv = _mm256_and_si256(cv,av); break;
+        case BitSetKernel::OP_ANDOR:
+          cv = _mm256_and_si256(cv,_mm256_or_si256(av,avx2_load(x,b,i)));
+          break;
+        case BitSetKernel::OP_NAND:
+          cv = _mm256_andnot_si256(av,cv); break;
+        default: GECODE_NEVER;
+        }
+        _mm256_storeu_si256(cp,cv);
+      }
+      scalar(o,i,n,x,a,b,c);
+    }
+
+    /// Intersection test with AVX2
+    template<class IndexType>
+    GECODE_TARGET_AVX2 bool
+    avx2(unsigned int n, const IndexType* x,
+         const BitSetData* a, const BitSetData* c) {
+      unsigned int i = 0U;
+      for (; i+4U <= n; i += 4U) {
+        __m256i cv =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c+i));
+        if (!_mm256_testz_si256(cv,avx2_load(x,a,i)))
+          return true;
+      }
+      return scalar(i,n,x,a,c);
+    }
+
+
+    /*
+     * AVX-512: eight words at a time
+     *
+     */
+
+    /// Load eight indices starting at \a x
+    GECODE_TARGET_AVX512 forceinline __m512i
+    avx512_index(const unsigned char* x) {
+      return _mm512_cvtepu8_epi64
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    /// Load eight indices starting at \a x
+    GECODE_TARGET_AVX512 forceinline __m512i
+    avx512_index(const unsigned short int* x) {
+      return _mm512_cvtepu16_epi64
+        (_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+    }
+    /// Load eight indices starting at \a x
+    GECODE_TARGET_AVX512 forceinline __m512i
+    avx512_index(const unsigned int* x) {
+      return _mm512_cvtepu32_epi64
+        (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x)));
+    }
+    /// Load the words \a a at indices \a x starting from \a i
+    template<class IndexType>
+    GECODE_TARGET_AVX512 forceinline __m512i
+    avx512_load(const IndexType* x, const BitSetData* a, unsigned int i) {
+      if (x == nullptr)
+        return _mm512_loadu_si512(a+i);
+      return _mm512_i64gather_epi64(avx512_index(x+i), a, 8);
+    }
+
+    /// Perform operation \a o with AVX-512
+    template<class IndexType>
+    GECODE_TARGET_AVX512 void
+    avx512(BitSetKernel::Op o, unsigned int n, const IndexType* x,
+           const BitSetData* a, const BitSetData* b, BitSetData* c) {
+      unsigned int i = 0U;
+      for (; i+8U <= n; i += 8U) {
+        __m512i cv = _mm512_loadu_si512(c+i);
+        __m512i av = avx512_load(x,a,i);
+        switch (o) {
+        case BitSetKernel::OP_OR:
+          cv = _mm512_or_si512(cv,av); break;
+        case BitSetKernel::OP_AND:
+          cv = _mm512_and_si512(cv,av); break;
+        case BitSetKernel::OP_ANDOR:
+          cv = _mm512_and_si512(cv,_mm512_or_si512(av,avx512_load(x,b,i)));
+          break;
+        case BitSetKernel::OP_NAND:
+          cv = _mm512_andnot_si512(av,cv); break;
+        default: GECODE_NEVER;
+        }
+        _mm512_storeu_si512(c+i,cv);
+      }
+      scalar(o,i,n,x,a,b,c);
+    }
+
+    /// Intersection test with AVX-512
+    template<class IndexType>
+    GECODE_TARGET_AVX512 bool
+    avx512(unsigned int n, const IndexType* x,
+           const BitSetData* a, const BitSetData* c) {
+      unsigned int i = 0U;
+      for (; i+8U <= n; i += 8U)
+        if (_mm512_test_epi64_mask(_mm512_loadu_si512(c+i),
+                                   avx512_load(x,a,i)) != 0)
+          return true;
+      return scalar(i,n,x,a,c);
+    }
+
+#endif
+
+    /// Return best instruction set supported by the processor
+    BitSetKernel::Level
+    detect(void) {
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+      if (BitSetData::bpb == 64U) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+          return BitSetKernel::L_AVX512;
+        if (__builtin_cpu_supports("avx2"))
+          return BitSetKernel::L_AVX2;
+      }
+#endif
+      return BitSetKernel::L_SCALAR;
+    }
+
+    /// Dispatch operation \a o
+    template<class IndexType>
+    forceinline void
+    dispatch(BitSetKernel::Level l, BitSetKernel::Op o,
+             unsigned int n, const IndexType* x,
+             const BitSetData* a, const BitSetData* b, BitSetData* c) {
+      switch (l) {
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+      case BitSetKernel::L_AVX512:
+        avx512(o,n,x,a,b,c); break;
+      case BitSetKernel::L_AVX2:
+        avx2(o,n,x,a,b,c); break;
+#endif
+      default:
+        scalar(o,0U,n,x,a,b,c); break;
+      }
+    }
+
+    /// Dispatch intersection test
+    template<class IndexType>
+    forceinline bool
+    dispatch(BitSetKernel::Level l, unsigned int n, const IndexType* x,
+             const BitSetData* a, const BitSetData* c) {
+      switch (l) {
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+      case BitSetKernel::L_AVX512:
+        return avx512(n,x,a,c);
+      case BitSetKernel::L_AVX2:
+        return avx2(n,x,a,c);
+#endif
+      default:
+        return scalar(0U,n,x,a,c);
+      }
+    }
+
+  }
+
+  BitSetKernel::Level BitSetKernel::l = detect();
+
+  void
+  BitSetKernel::enable(bool b) {
+    l = b ? detect() : L_SCALAR;
+  }
+
+  void
+  BitSetKernel::run(Op o, unsigned int n, const unsigned char* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c) {
+    dispatch(l,o,n,x,a,b,c);
+  }
+  void
+  BitSetKernel::run(Op o, unsigned int n, const unsigned short int* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c) {
+    dispatch(l,o,n,x,a,b,c);
+  }
+  void
+  BitSetKernel::run(Op o, unsigned int n, const unsigned int* x,
+                    const BitSetData* a, const BitSetData* b,
+                    BitSetData* c) {
+    dispatch(l,o,n,x,a,b,c);
+  }
+
+  bool
+  BitSetKernel::intersects(unsigned int n, const unsigned char* x,
+                           const BitSetData* a, const BitSetData* c) {
+    return dispatch(l,n,x,a,c);
+  }
+  bool
+  BitSetKernel::intersects(unsigned int n, const unsigned short int* x,
+                           const BitSetData* a, const BitSetData* c) {
+    return dispatch(l,n,x,a,c);
+  }
+  bool
+  BitSetKernel::intersects(unsigned int n, const unsigned int* x,
+                           const BitSetData* a, const BitSetData* c) {
+    return dispatch(l,n,x,a,c);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -37,6 +37,24 @@
 
 namespace Gecode { namespace Int { namespace Extensional {
 
+  /*
+   * Bit set kernels
+   *
+   */
+  forceinline bool
+  BitSetKernel::use(unsigned int n) {
+    return (n >= min_words) && (l != L_SCALAR);
+  }
+  forceinline BitSetKernel::Level
+  BitSetKernel::level(void) {
+    return l;
+  }
+
+
+  /*
+   * Bit set
+   *
+   */
   template<class IndexType>
   forceinline unsigned int
   BitSet<IndexType>::limit(void) const {
@@ -144,6 +162,18 @@ namespace Gecode { namespace Int { namespace Extensional {
     }
   }
 
+  template<class IndexType>
+  forceinline void
+  BitSet<IndexType>::remove_zeroes(void) {
+    // Words above i are non-zero, hence only non-zero words are moved down
+    for (IndexType i = _limit; i--; )
+      if (_bits[i].none()) {
+        _limit--;
+        _bits[i] = _bits[_limit];
+        _index[i] = _index[_limit];
+      }
+  }
+
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::clear_mask(BitSetData* mask) const {
@@ -158,6 +188,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::add_to_mask(const BitSetData* b, BitSetData* mask) const {
     assert(_limit > 0U);
+    if (BitSetKernel::use(_limit)) {
+      BitSetKernel::run(BitSetKernel::OP_OR,_limit,_index,b,nullptr,mask);
+      return;
+    }
     for (IndexType i=0; i<_limit; i++)
       mask[i] = BitSetData::o(mask[i],b[_index[i]]);
   }
@@ -167,6 +201,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+    if (BitSetKernel::use(_limit)) {
+      const IndexType* x = sparse ? _index : nullptr;
+      BitSetKernel::run(BitSetKernel::OP_AND,_limit,x,mask,nullptr,_bits);
+      remove_zeroes();
+      return;
+    }
     if (sparse) {
       for (IndexType i = _limit; i--; ) {
         assert(!_bits[i].none());
@@ -191,6 +231,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
+    if (BitSetKernel::use(_limit)) {
+      BitSetKernel::run(BitSetKernel::OP_ANDOR,_limit,_index,a,b,_bits);
+      remove_zeroes();
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w_i = _bits[i];
@@ -206,6 +251,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
+    if (BitSetKernel::use(_limit)) {
+      BitSetKernel::run(BitSetKernel::OP_NAND,_limit,_index,b,nullptr,_bits);
+      remove_zeroes();
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
@@ -217,6 +267,8 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
+    if (BitSetKernel::use(_limit))
+      return BitSetKernel::intersects(_limit,_index,b,_bits);
     for (IndexType i=0; i<_limit; i++)
       if (!BitSetData::a(_bits[i],b[_index[i]]).none())
         return true;
@@ -37,6 +37,17 @@
 
 #include <gecode/int.hh>
 #include <algorithm>
+#include <fstream>
+#include <cstring>
+
+#if defined(HAVE_MMAP) && defined(GECODE_HAS_UNISTD_H)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define GECODE_TUPLESET_MMAP
+#endif
 
 namespace Gecode { namespace Int { namespace Extensional {
 
@@ -91,6 +102,50 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
+  /**
+   * \brief Layout of tuple set files
+   *
+   * A file starts with a header of \a n_header words (each a
+   * <code>long long int</code>), followed by the number of ranges
+   * for each position, followed by minimum, maximum, and offset
+   * of the supports for each range. The tuples and the supports
+   * are stored afterwards, each aligned to \a align bytes, such that
+   * they can be used directly from a memory mapping of the file.
+   */
+  namespace TupleSetFile {
+    /// Magic number (spells "GECODETS")
+    const long long int magic = 0x535445444f434547LL;
+    /// Version of file format
+    const long long int version = 1LL;
+    /// Alignment in bytes of tuples and supports
+    const std::size_t align = 64U;
+    /// Fields of the header
+    enum Field {
+      F_MAGIC,    ///< Magic number
+      F_VERSION,  ///< Version
+      F_BPB,      ///< Bits per bit set word
+      F_INT,      ///< Size of an integer
+      F_ARITY,    ///< Arity
+      F_TUPLES,   ///< Number of tuples
+      F_WORDS,    ///< Number of words per support
+      F_MIN,      ///< Smallest value
+      F_MAX,      ///< Largest value
+      F_KEY,      ///< Hash key
+      F_RANGES,   ///< Number of ranges
+      F_VALS,     ///< Number of values
+      F_TD,       ///< Offset of tuples
+      F_SUPPORT,  ///< Offset of supports
+      F_SIZE,     ///< Size of file
+      n_header    ///< Number of header fields
+    };
+    /// Round \a n up to alignment
+    forceinline std::size_t
+    aligned(std::size_t n) {
+      return (n + align - 1U) & ~(align - 1U);
+    }
+  }
+
+
 }}}
 
 namespace Gecode {
@@ -252,10 +307,20 @@ namespace Gecode {
   }
 
   TupleSet::Data::~Data(void) {
+#ifdef GECODE_TUPLESET_MMAP
+    if (mm != nullptr) {
+      (void) munmap(mm, n_mm);
+    } else {
+      heap.rfree(td);
+      heap.rfree(support);
+    }
+#else
+    assert(mm == nullptr);
     heap.rfree(td);
+    heap.rfree(support);
+#endif
     heap.rfree(vd);
     heap.rfree(range);
-    heap.rfree(support);
   }
 
 
@@ -443,6 +508,254 @@ namespace Gecode {
     finalize();
   } 
 
+  void
+  TupleSet::save(const char* fn) const {
+    using namespace Int::Extensional;
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::save()");
+    if (!raw().finalized())
+      throw Int::NotYetFinalized("TupleSet::save()");
+    const Data& d = data();
+    // Count ranges and values
+    long long int n_ranges = 0, n_vals = 0;
+    for (int a=0; a<d.arity; a++)
+      if (d.n_tuples > 0) {
+        n_ranges += d.vd[a].n;
+        for (unsigned int i=0U; i<d.vd[a].n; i++)
+          n_vals += d.vd[a].r[i].width();
+      }
+    std::size_t n_td = static_cast<std::size_t>(d.n_tuples) * d.arity;
+    std::size_t n_s = static_cast<std::size_t>(n_vals) * d.n_words;
+    std::size_t o_td =
+      TupleSetFile::aligned(sizeof(long long int) *
+                            (TupleSetFile::n_header + d.arity + 3*n_ranges));
+    std::size_t o_s = TupleSetFile::aligned(o_td + sizeof(int)*n_td);
+    std::size_t size = o_s + sizeof(BitSetData)*n_s;
+
+    Region r;
+    long long int* h = r.alloc<long long int>(TupleSetFile::n_header);
+    h[TupleSetFile::F_MAGIC] = TupleSetFile::magic;
+    h[TupleSetFile::F_VERSION] = TupleSetFile::version;
+    h[TupleSetFile::F_BPB] = BitSetData::bpb;
+    h[TupleSetFile::F_INT] = sizeof(int);
+    h[TupleSetFile::F_ARITY] = d.arity;
+    h[TupleSetFile::F_TUPLES] = d.n_tuples;
+    h[TupleSetFile::F_WORDS] = d.n_words;
+    h[TupleSetFile::F_MIN] = d.min;
+    h[TupleSetFile::F_MAX] = d.max;
+    h[TupleSetFile::F_KEY] = static_cast<long long int>(d.key);
+    h[TupleSetFile::F_RANGES] = n_ranges;
+    h[TupleSetFile::F_VALS] = n_vals;
+    h[TupleSetFile::F_TD] = static_cast<long long int>(o_td);
+    h[TupleSetFile::F_SUPPORT] = static_cast<long long int>(o_s);
+    h[TupleSetFile::F_SIZE] = static_cast<long long int>(size);
+
+    std::ofstream os(fn, std::ios::binary | std::ios::trunc);
+    if (!os)
+      throw Int::IllegalTupleSetFile("TupleSet::save()");
+    os.write(reinterpret_cast<const char*>(h),
+             sizeof(long long int) * TupleSetFile::n_header);
+    // Number of ranges per position
+    for (int a=0; a<d.arity; a++) {
+      long long int n = (d.n_tuples > 0) ? d.vd[a].n : 0;
+      os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    }
+    // Ranges with offsets of supports
+    for (int a=0; a<d.arity; a++)
+      if (d.n_tuples > 0)
+        for (unsigned int i=0U; i<d.vd[a].n; i++) {
+          long long int rd[3] = {
+            d.vd[a].r[i].min, d.vd[a].r[i].max,
+            static_cast<long long int>(d.vd[a].r[i].s - d.support)
+          };
+          os.write(reinterpret_cast<const char*>(&rd[0]), sizeof(rd));
+        }
+    // Tuples and supports, both aligned
+    static const char pad[TupleSetFile::align] = { 0 };
+    os.write(pad, o_td - static_cast<std::size_t>(os.tellp()));
+    os.write(reinterpret_cast<const char*>(d.td), sizeof(int)*n_td);
+    os.write(pad, o_s - static_cast<std::size_t>(os.tellp()));
+    os.write(reinterpret_cast<const char*>(d.support),
+             sizeof(BitSetData)*n_s);
+    os.close();
+    if (!os)
+      throw Int::IllegalTupleSetFile("TupleSet::save()");
+  }
+
+  TupleSet::TupleSet(const char* fn) {
+    using namespace Int::Extensional;
+    const char* l = "TupleSet::TupleSet(const char*)";
+    // Access file contents, either mapped or read into memory
+    const char* m;
+    std::size_t size;
+#ifdef GECODE_TUPLESET_MMAP
+    void* mm;
+    {
+      int fd = open(fn, O_RDONLY);
+      if (fd == -1)
+        throw Int::IllegalTupleSetFile(l);
+      struct stat sbuf;
+      if ((fstat(fd, &sbuf) == -1) || (sbuf.st_size <= 0)) {
+        (void) close(fd);
+        throw Int::IllegalTupleSetFile(l);
+      }
+      size = static_cast<std::size_t>(sbuf.st_size);
+      mm = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      (void) close(fd);
+      if (mm == MAP_FAILED)
+        throw Int::IllegalTupleSetFile(l);
+      m = static_cast<const char*>(mm);
+    }
+#else
+    char* buffer;
+    {
+      std::ifstream is(fn, std::ios::binary | std::ios::ate);
+      if (!is)
+        throw Int::IllegalTupleSetFile(l);
+      std::streamoff n = is.tellg();
+      if (n <= 0)
+        throw Int::IllegalTupleSetFile(l);
+      size = static_cast<std::size_t>(n);
+      buffer = heap.alloc<char>(size);
+      is.seekg(0);
+      if (!is.read(buffer, static_cast<std::streamsize>(size))) {
+        heap.rfree(buffer);
+        throw Int::IllegalTupleSetFile(l);
+      }
+      m = buffer;
+    }
+#endif
+    // Read and validate header
+    long long int h[TupleSetFile::n_header];
+    long long int arity = 0;
+    bool ok = size >= sizeof(h);
+    if (ok) {
+      std::memcpy(&h[0], m, sizeof(h));
+      arity = h[TupleSetFile::F_ARITY];
+      ok = ((h[TupleSetFile::F_MAGIC] == TupleSetFile::magic) &&
+            (h[TupleSetFile::F_VERSION] == TupleSetFile::version) &&
+            (h[TupleSetFile::F_BPB] == BitSetData::bpb) &&
+            (h[TupleSetFile::F_INT] == sizeof(int)) &&
+            (h[TupleSetFile::F_SIZE] == static_cast<long long int>(size)) &&
+            (arity > 0) && (arity <= Int::Limits::max) &&
+            (h[TupleSetFile::F_TUPLES] >= 0) &&
+            (h[TupleSetFile::F_TUPLES] <= Int::Limits::max) &&
+            (h[TupleSetFile::F_RANGES] >= 0) &&
+            (h[TupleSetFile::F_VALS] >= h[TupleSetFile::F_RANGES]) &&
+            (arity <= static_cast<long long int>(size)) &&
+            (h[TupleSetFile::F_TUPLES] <= static_cast<long long int>(size)) &&
+            (h[TupleSetFile::F_VALS] <= static_cast<long long int>(size)) &&
+            (h[TupleSetFile::F_WORDS] ==
+             static_cast<long long int>
+             (BitSetData::data(static_cast<unsigned int>
+                               (h[TupleSetFile::F_TUPLES])))) &&
+            (h[TupleSetFile::F_TD] >= 0) &&
+            (h[TupleSetFile::F_SUPPORT] >= h[TupleSetFile::F_TD]) &&
+            (h[TupleSetFile::F_SUPPORT] <= static_cast<long long int>(size)) &&
+            (h[TupleSetFile::F_TD] % TupleSetFile::align == 0) &&
+            (h[TupleSetFile::F_SUPPORT] % TupleSetFile::align == 0) &&
+            (static_cast<std::size_t>(h[TupleSetFile::F_TD]) >=
+             sizeof(long long int) *
+             static_cast<std::size_t>(TupleSetFile::n_header + arity +
+                                      3*h[TupleSetFile::F_RANGES])) &&
+            (static_cast<std::size_t>(h[TupleSetFile::F_SUPPORT] -
+                                      h[TupleSetFile::F_TD]) >=
+             sizeof(int) *
+             static_cast<std::size_t>(h[TupleSetFile::F_TUPLES] * arity)) &&
+            (size - static_cast<std::size_t>(h[TupleSetFile::F_SUPPORT]) ==
+             sizeof(BitSetData) *
+             static_cast<std::size_t>(h[TupleSetFile::F_VALS] *
+                                      h[TupleSetFile::F_WORDS])));
+    }
+    if (!ok) {
+#ifdef GECODE_TUPLESET_MMAP
+      (void) munmap(mm, size);
+#else
+      heap.rfree(buffer);
+#endif
+      throw Int::IllegalTupleSetFile(l);
+    }
+
+    // Read number of ranges per position and ranges
+    long long int n_ranges = h[TupleSetFile::F_RANGES];
+    long long int n_vals = h[TupleSetFile::F_VALS];
+    long long int n_words = h[TupleSetFile::F_WORDS];
+    Region r;
+    long long int* rd = r.alloc<long long int>
+      (static_cast<long int>(arity + 3*n_ranges));
+    std::memcpy(rd, m + sizeof(h), sizeof(long long int) *
+                static_cast<std::size_t>(arity + 3*n_ranges));
+    {
+      // Ranges must cover all positions and supports must lie in the file
+      long long int n = 0;
+      for (long long int a=0; ok && (a<arity); a++) {
+        ok = (rd[a] >= 0) && ((rd[a] > 0) == (h[TupleSetFile::F_TUPLES] > 0));
+        n += rd[a];
+      }
+      ok = ok && (n == n_ranges);
+      const long long int* cr = rd + arity;
+      for (long long int i=0; ok && (i<n_ranges); i++)
+        ok = (cr[3*i] <= cr[3*i+1]) && (cr[3*i+2] >= 0) &&
+          (cr[3*i+2] + n_words*(cr[3*i+1]-cr[3*i]+1) <= n_vals*n_words);
+    }
+    if (!ok) {
+#ifdef GECODE_TUPLESET_MMAP
+      (void) munmap(mm, size);
+#else
+      heap.rfree(buffer);
+#endif
+      throw Int::IllegalTupleSetFile(l);
+    }
+
+    Data* d = new Data(static_cast<int>(arity));
+    object(d);
+    heap.rfree(d->td);
+    // Mark as finalized
+    d->n_free = -1;
+    d->n_tuples = static_cast<int>(h[TupleSetFile::F_TUPLES]);
+    d->n_words = static_cast<unsigned int>(n_words);
+    d->min = static_cast<int>(h[TupleSetFile::F_MIN]);
+    d->max = static_cast<int>(h[TupleSetFile::F_MAX]);
+    d->key = static_cast<std::size_t>(h[TupleSetFile::F_KEY]);
+
+    const char* td = m + h[TupleSetFile::F_TD];
+    const char* s = m + h[TupleSetFile::F_SUPPORT];
+#ifdef GECODE_TUPLESET_MMAP
+    // Use tuples and supports in place
+    d->mm = mm; d->n_mm = size;
+    d->td = reinterpret_cast<int*>(const_cast<char*>(td));
+    d->support = reinterpret_cast<BitSetData*>(const_cast<char*>(s));
+#else
+    // Copy tuples and supports
+    std::size_t n_td = static_cast<std::size_t>(d->n_tuples) * d->arity;
+    std::size_t n_s = static_cast<std::size_t>(n_vals * n_words);
+    d->td = heap.alloc<int>(n_td);
+    std::memcpy(d->td, td, sizeof(int)*n_td);
+    d->support = heap.alloc<BitSetData>(n_s);
+    std::memcpy(d->support, s, sizeof(BitSetData)*n_s);
+    heap.rfree(buffer);
+#endif
+    if (d->n_tuples == 0) {
+      d->td = nullptr; d->support = nullptr;
+      return;
+    }
+
+    // Rebuild ranges as they refer to the supports by pointers
+    Range* cr = d->range = heap.alloc<Range>(static_cast<int>(n_ranges));
+    const long long int* fr = rd + arity;
+    for (int a=0; a<d->arity; a++) {
+      d->vd[a].n = static_cast<unsigned int>(rd[a]);
+      d->vd[a].r = cr;
+      for (unsigned int i=0U; i<d->vd[a].n; i++) {
+        cr->min = static_cast<int>(fr[0]);
+        cr->max = static_cast<int>(fr[1]);
+        cr->s = d->support + fr[2];
+        cr++; fr += 3;
+      }
+    }
+    assert(cr == d->range + n_ranges);
+  }
+
   bool
   TupleSet::equal(const TupleSet& t) const {
     assert(tuples() == t.tuples());
@@ -718,6 +718,14 @@ namespace Gecode { namespace Int { namespace Linear {
     using Lin<Val,P,N,PC_INT_BND>::x;
     using Lin<Val,P,N,PC_INT_BND>::y;
     using Lin<Val,P,N,PC_INT_BND>::c;
+    /**
+     * \brief Upper bound on the width of all views
+     *
+     * As domains only shrink, the bound remains valid once computed.
+     * If the slack of the inequality is not smaller, propagation can
+     * not prune any view and the pruning loop is skipped.
+     */
+    Val w;
 
     /// Constructor for cloning \a p
     Lq(Space& home, Lq& p);
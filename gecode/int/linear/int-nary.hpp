@@ -624,7 +624,8 @@ namespace Gecode { namespace Int { namespace Linear {
   template<class Val, class P, class N>
   forceinline
   Lq<Val,P,N>::Lq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c)
-    : Lin<Val,P,N,PC_INT_BND>(home,x,y,c) {}
+    : Lin<Val,P,N,PC_INT_BND>(home,x,y,c),
+      w(std::numeric_limits<Val>::max()) {}
 
   template<class Val, class P, class N>
   ExecStatus
@@ -644,7 +645,7 @@ namespace Gecode { namespace Int { namespace Linear {
   template<class Val, class P, class N>
   forceinline
   Lq<Val,P,N>::Lq(Space& home, Lq<Val,P,N>& p)
-    : Lin<Val,P,N,PC_INT_BND>(home,p) {}
+    : Lin<Val,P,N,PC_INT_BND>(home,p), w(p.w) {}
 
   /**
    * \brief Rewriting of inequality to binary propagators
@@ -784,8 +785,14 @@ namespace Gecode { namespace Int { namespace Linear {
 
     sl += c;
 
+    // No view is wider than the slack, hence nothing can be pruned
+    if (sl >= w)
+      return ES_FIX;
+
     ExecStatus es = ES_FIX;
     bool assigned = true;
+    // Recompute the width bound while pruning
+    Val nw = 0;
     for (int i=0; i<x.size(); i++) {
       assert(!x[i].assigned());
       Val slx = sl + x[i].min();
@@ -796,6 +803,7 @@ namespace Gecode { namespace Int { namespace Linear {
         assigned = false;
       if (me_modified(me) && (slx != x[i].max()))
         es = ES_NOFIX;
+      nw = std::max(nw,static_cast<Val>(x[i].max() - x[i].min()));
     }
 
     for (int i=0; i<y.size(); i++) {
@@ -808,7 +816,9 @@ namespace Gecode { namespace Int { namespace Linear {
         assigned = false;
       if (me_modified(me) && (sly != y[i].min()))
         es = ES_NOFIX;
+      nw = std::max(nw,static_cast<Val>(y[i].max() - y[i].min()));
     }
+    w = nw;
     return assigned ? home.ES_SUBSUMED(*this) : es;
   }
 
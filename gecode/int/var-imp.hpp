@@ -178,6 +178,53 @@ namespace Gecode { namespace Int {
       //@}
     };
 
+    /**
+     * \brief Bitsets for domains with holes
+     *
+     * Bit \a i of the bitset corresponds to the value \a base + \a i.
+     * Only the bits for values between the minimum and the maximum
+     * of the domain are meaningful.
+     */
+    class BitDom {
+    public:
+      /// Value corresponding to the first bit
+      int base;
+      /// Number of data elements
+      unsigned int n;
+      /// The bits (actually \a n data elements)
+      Support::BitSetData data[1];
+      /// \name Memory management
+      //@{
+      /// Allocate for values from \a min to \a max (all included if \a setbits)
+      static BitDom* allocate(Space& home, int min, int max, bool setbits);
+      /// Return copy for values from \a min to \a max
+      BitDom* copy(Space& home, int min, int max) const;
+      /// Free memory
+      void dispose(Space& home);
+      //@}
+      /// \name Access and update
+      //@{
+      /// Test whether value \a v is included
+      bool get(int v) const;
+      /// Exclude value \a v
+      void clear(int v);
+      /// Include values from \a l to \a h
+      void set(int l, int h);
+      /// Exclude values from \a l to \a h
+      void clear(int l, int h);
+      /// Return smallest included value from \a v to \a m (\a m+1 if none)
+      int next(int v, int m) const;
+      /// Return smallest excluded value from \a v to \a m (\a m+1 if none)
+      int skip(int v, int m) const;
+      /// Return largest included value from \a m to \a v (\a m-1 if none)
+      int prev(int v, int m) const;
+      /// Return largest excluded value from \a m to \a v (\a m-1 if none)
+      int skip_prev(int v, int m) const;
+      /// Return number of included values from \a l to \a h
+      unsigned int ones(int l, int h) const;
+      //@}
+    };
+
     /**
      * \brief Domain information
      *
@@ -186,8 +233,12 @@ namespace Gecode { namespace Int {
      * of a RangeList defining the domain.
      */
     RangeList dom;
-    /// Link the last element
-    RangeList* _lst;
+    union {
+      /// Link the last element (domain with holes as range list)
+      RangeList* _lst;
+      /// Bits of domain (domain with holes as bitset)
+      BitDom* _bits;
+    };
     /// Return first element of rangelist
     RangeList* fst(void) const;
     /// Set first element of rangelist
@@ -199,6 +250,24 @@ namespace Gecode { namespace Int {
     /// Size of holes in the domain
     unsigned int holes;
 
+    /**
+     * \brief Maximal width of a domain with holes that is represented as bitset
+     *
+     * When a domain gets its first hole (or is created with holes)
+     * and is not wider, it is represented by a bitset rather than by
+     * a range list. The representation is kept until the domain
+     * becomes a range again.
+     */
+    static const unsigned int bits_max = 512U;
+    /// Test whether domain has holes and is represented as bitset
+    bool bitset(void) const;
+    /// Return bits of domain (only if represented as bitset)
+    BitDom* bits(void) const;
+    /// Set bits of domain to \a b
+    void bits(BitDom* b);
+    /// Update domain after values have been excluded from bits \a b
+    GECODE_INT_EXPORT ModEvent bits_pruned(Space& home, BitDom* b);
+
   protected:
     /// Constructor for cloning \a x
     IntVarImp(Space& home, IntVarImp& x);
@@ -393,8 +462,14 @@ namespace Gecode { namespace Int {
   private:
     /// Previous range
     const IntVarImp::RangeList* p;
-    /// Current range
+    /// Current range (entire domain if represented as bitset)
     const IntVarImp::RangeList* c;
+    /// Bits of domain (NULL if not represented as bitset)
+    const IntVarImp::BitDom* b;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
   public:
     /// \name Constructors and initialization
     //@{
@@ -436,8 +511,14 @@ namespace Gecode { namespace Int {
   private:
     /// Next range
     const IntVarImp::RangeList* n;
-    /// Current range
+    /// Current range (entire domain if represented as bitset)
     const IntVarImp::RangeList* c;
+    /// Bits of domain (NULL if not represented as bitset)
+    const IntVarImp::BitDom* b;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
   public:
     /// \name Constructors and initialization
     //@{
@@ -45,11 +45,23 @@ namespace Gecode { namespace Int {
   int
   IntVarImp::med(void) const {
     // Computes the median
-    if (fst() == NULL)
+    if (range())
       return (dom.min()+dom.max())/2 - ((dom.min()+dom.max())%2 < 0 ? 1 : 0);
     unsigned int i = size() / 2;
     if (size() % 2 == 0)
       i--;
+    if (fst() == NULL) {
+      const BitDom* b = bits();
+      int l = dom.min();
+      while (true) {
+        int h = b->skip(l,dom.max()) - 1;
+        unsigned int w = static_cast<unsigned int>(h-l) + 1U;
+        if (i < w)
+          return l + static_cast<int>(i);
+        i -= w;
+        l = b->next(h+1,dom.max());
+      }
+    }
     const RangeList* p = NULL;
     const RangeList* c = fst();
     while (i >= c->width()) {
@@ -61,6 +73,8 @@ namespace Gecode { namespace Int {
 
   bool
   IntVarImp::in_full(int m) const {
+    if (fst() == NULL)
+      return bits()->get(m);
     if (closer_min(m)) {
       const RangeList* p = NULL;
       const RangeList* c = fst();
@@ -91,6 +105,15 @@ namespace Gecode { namespace Int {
     if (range()) { // Is already range...
       dom.max(m);
       if (assigned()) me = ME_INT_VAL;
+    } else if (fst() == NULL) { // Is bitset...
+      int max_b = bits()->prev(m,dom.min());
+      holes -= (static_cast<unsigned int>(old_max-max_b) -
+                bits()->ones(max_b+1,old_max));
+      dom.max(max_b);
+      if (holes == 0) {
+        bits()->dispose(home);
+        if (assigned()) me = ME_INT_VAL;
+      }
     } else if (m < fst()->next(NULL)->min()) { // Becomes range...
       dom.max(std::min(m,fst()->max()));
       fst()->dispose(home,NULL,lst());
@@ -125,6 +148,15 @@ namespace Gecode { namespace Int {
     if (range()) { // Is already range...
       dom.min(m);
       if (assigned()) me = ME_INT_VAL;
+    } else if (fst() == NULL) { // Is bitset...
+      int min_b = bits()->next(m,dom.max());
+      holes -= (static_cast<unsigned int>(min_b-old_min) -
+                bits()->ones(old_min,min_b-1));
+      dom.min(min_b);
+      if (holes == 0) {
+        bits()->dispose(home);
+        if (assigned()) me = ME_INT_VAL;
+      }
     } else if (m > lst()->prev(NULL)->max()) { // Becomes range...
       dom.min(std::max(m,lst()->min()));
       fst()->dispose(home,NULL,lst());
@@ -154,7 +186,13 @@ namespace Gecode { namespace Int {
   ModEvent
   IntVarImp::eq_full(Space& home, int m) {
     dom.min(m); dom.max(m);
-    if (!range()) {
+    if (bitset()) {
+      bool failed = !bits()->get(m);
+      bits()->dispose(home);
+      holes = 0;
+      if (failed)
+        return fail(home);
+    } else if (!range()) {
       bool failed = false;
       RangeList* p = NULL;
       RangeList* c = fst();
@@ -189,6 +227,10 @@ namespace Gecode { namespace Int {
       } else if (m == dom.max()) {
         dom.max(m-1);
         me = assigned() ? ME_INT_VAL : ME_INT_BND;
+      } else if (width() <= bits_max) {
+        BitDom* b = BitDom::allocate(home,dom.min(),dom.max(),true);
+        b->clear(m);
+        fst(NULL); bits(b); holes = 1;
       } else {
         RangeList* f = new (home) RangeList(dom.min(),m-1);
         RangeList* l = new (home) RangeList(m+1,dom.max());
@@ -196,6 +238,27 @@ namespace Gecode { namespace Int {
         l->prevnext(f,NULL);
         fst(f); lst(l); holes = 1;
       }
+    } else if (fst() == NULL) { // Concerns a bitset...
+      BitDom* b = bits();
+      if (!b->get(m))
+        return ME_INT_NONE;
+      if (m == dom.min()) {
+        int min_b = b->next(m+1,dom.max());
+        holes -= static_cast<unsigned int>(min_b-m-1);
+        dom.min(min_b);
+        me = ME_INT_BND;
+      } else if (m == dom.max()) {
+        int max_b = b->prev(m-1,dom.min());
+        holes -= static_cast<unsigned int>(m-max_b-1);
+        dom.max(max_b);
+        me = ME_INT_BND;
+      } else {
+        b->clear(m); holes += 1;
+      }
+      if (holes == 0) {
+        b->dispose(home);
+        if (assigned()) me = ME_INT_VAL;
+      }
     } else if (m < fst()->next(NULL)->min()) { // Concerns the first range...
       int f_max = fst()->max();
       if (m > f_max)
@@ -317,7 +380,9 @@ namespace Gecode { namespace Int {
   IntVarImp::IntVarImp(Space& home, IntVarImp& x)
     : IntVarImpBase(home,x), dom(x.dom.min(),x.dom.max()) {
     holes = x.holes;
-    if (holes) {
+    if (x.bitset()) {
+      fst(NULL); bits(x.bits()->copy(home,dom.min(),dom.max()));
+    } else if (holes) {
       int m = 1;
       // Compute length
       {
@@ -349,6 +414,36 @@ namespace Gecode { namespace Int {
     }
   }
 
+  ModEvent
+  IntVarImp::bits_pruned(Space& home, BitDom* b) {
+    assert(range() || (fst() == NULL));
+    int min_b = b->next(dom.min(),dom.max());
+    if (min_b > dom.max()) {
+      b->dispose(home);
+      holes = 0;
+      return fail(home);
+    }
+    int max_b = b->prev(dom.max(),min_b);
+    unsigned int s = b->ones(min_b,max_b);
+    if (s == size()) {
+      if (range())
+        b->dispose(home);
+      return ME_INT_NONE;
+    }
+    ModEvent me = ((min_b == dom.min()) && (max_b == dom.max())) ?
+      ME_INT_DOM : ME_INT_BND;
+    dom.min(min_b); dom.max(max_b);
+    holes = width() - s;
+    if (holes == 0) {
+      b->dispose(home);
+      if (assigned()) me = ME_INT_VAL;
+    } else {
+      bits(b);
+    }
+    IntDelta d;
+    return notify(home,me,d);
+  }
+
   IntVarImp*
   IntVarImp::perform_copy(Space& home) {
     return new (home) IntVarImp(home,*this);
@@ -154,6 +154,177 @@ namespace Gecode { namespace Int {
 #undef GECODE_INT_RL2PD
 #undef GECODE_INT_PD2RL
 
+  /*
+   * Bitsets for domains
+   *
+   */
+
+  forceinline IntVarImp::BitDom*
+  IntVarImp::BitDom::allocate(Space& home, int min, int max, bool setbits) {
+    unsigned int n = Support::BitSetData::data
+      (static_cast<unsigned int>(max-min)+1U);
+    BitDom* b = static_cast<BitDom*>
+      (home.ralloc(sizeof(BitDom) + (n-1)*sizeof(Support::BitSetData)));
+    b->base = min; b->n = n;
+    for (unsigned int i=0; i<n; i++)
+      b->data[i].init(setbits);
+    return b;
+  }
+
+  forceinline IntVarImp::BitDom*
+  IntVarImp::BitDom::copy(Space& home, int min, int max) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int f = static_cast<unsigned int>(min-base) / bpb;
+    unsigned int l = static_cast<unsigned int>(max-base) / bpb;
+    BitDom* b = static_cast<BitDom*>
+      (home.ralloc(sizeof(BitDom) + (l-f)*sizeof(Support::BitSetData)));
+    b->base = base + static_cast<int>(f*bpb); b->n = l-f+1;
+    for (unsigned int i=0; i<b->n; i++)
+      b->data[i] = data[f+i];
+    return b;
+  }
+
+  forceinline void
+  IntVarImp::BitDom::dispose(Space& home) {
+    home.rfree(this, sizeof(BitDom) + (n-1)*sizeof(Support::BitSetData));
+  }
+
+  forceinline bool
+  IntVarImp::BitDom::get(int v) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    return data[p / bpb].get(p % bpb);
+  }
+
+  forceinline void
+  IntVarImp::BitDom::clear(int v) {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    data[p / bpb].clear(p % bpb);
+  }
+
+  forceinline void
+  IntVarImp::BitDom::set(int l, int h) {
+    assert(l <= h);
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    if (i == j) {
+      data[i].set(p % bpb, q % bpb);
+    } else {
+      data[i].set(p % bpb, bpb-1U);
+      for (unsigned int k=i+1; k<j; k++)
+        data[k].init(true);
+      data[j].set(0U, q % bpb);
+    }
+  }
+
+  forceinline void
+  IntVarImp::BitDom::clear(int l, int h) {
+    assert(l <= h);
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    if (i == j) {
+      data[i].clear(p % bpb, q % bpb);
+    } else {
+      data[i].clear(p % bpb, bpb-1U);
+      for (unsigned int k=i+1; k<j; k++)
+        data[k].init(false);
+      data[j].clear(0U, q % bpb);
+    }
+  }
+
+  forceinline int
+  IntVarImp::BitDom::next(int v, int m) const {
+    if (v > m)
+      return m+1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int l = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!data[i].any(o,bpb-1U)) {
+      if (++i > l / bpb)
+        return m+1;
+      o = 0U;
+    }
+    p = i*bpb + data[i].next(o);
+    return (p <= l) ? base + static_cast<int>(p) : m+1;
+  }
+
+  forceinline int
+  IntVarImp::BitDom::skip(int v, int m) const {
+    if (v > m)
+      return m+1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int l = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!(~data[i]).any(o,bpb-1U)) {
+      if (++i > l / bpb)
+        return m+1;
+      o = 0U;
+    }
+    p = i*bpb + (~data[i]).next(o);
+    return (p <= l) ? base + static_cast<int>(p) : m+1;
+  }
+
+  forceinline int
+  IntVarImp::BitDom::prev(int v, int m) const {
+    if (v < m)
+      return m-1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int f = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!data[i].any(0U,o)) {
+      if (i-- == f / bpb)
+        return m-1;
+      o = bpb-1U;
+    }
+    p = i*bpb + data[i].prev(o);
+    return (p >= f) ? base + static_cast<int>(p) : m-1;
+  }
+
+  forceinline int
+  IntVarImp::BitDom::skip_prev(int v, int m) const {
+    if (v < m)
+      return m-1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int f = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!(~data[i]).any(0U,o)) {
+      if (i-- == f / bpb)
+        return m-1;
+      o = bpb-1U;
+    }
+    p = i*bpb + (~data[i]).prev(o);
+    return (p >= f) ? base + static_cast<int>(p) : m-1;
+  }
+
+  forceinline unsigned int
+  IntVarImp::BitDom::ones(int l, int h) const {
+    assert(l <= h);
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    if (i == j)
+      return data[i].ones(p % bpb, q % bpb);
+    unsigned int s = data[i].ones(p % bpb, bpb-1U);
+    for (unsigned int k=i+1; k<j; k++)
+      s += data[k].ones();
+    return s + data[j].ones(0U, q % bpb);
+  }
+
+
   /*
    * Mainitaining range lists for variable domain
    *
@@ -179,6 +350,21 @@ namespace Gecode { namespace Int {
     _lst = l;
   }
 
+  forceinline bool
+  IntVarImp::bitset(void) const {
+    return (holes != 0U) && (fst() == NULL);
+  }
+
+  forceinline IntVarImp::BitDom*
+  IntVarImp::bits(void) const {
+    return _bits;
+  }
+
+  forceinline void
+  IntVarImp::bits(IntVarImp::BitDom* b) {
+    _bits = b;
+  }
+
   /*
    * Creation of new variable implementations
    *
@@ -191,7 +377,13 @@ namespace Gecode { namespace Int {
   forceinline
   IntVarImp::IntVarImp(Space& home, const IntSet& d)
     : IntVarImpBase(home), dom(d.min(),d.max()) {
-    if (d.ranges() > 1) {
+    if ((d.ranges() > 1) && (dom.width() <= bits_max)) {
+      BitDom* b = BitDom::allocate(home,d.min(),d.max(),false);
+      for (int i=0; i<d.ranges(); i++)
+        b->set(d.min(i),d.max(i));
+      fst(NULL); bits(b);
+      holes = dom.width() - d.size();
+    } else if (d.ranges() > 1) {
       int n = d.ranges();
       assert(n >= 2);
       RangeList* r = home.alloc<RangeList>(n);
@@ -236,7 +428,7 @@ namespace Gecode { namespace Int {
 
   forceinline bool
   IntVarImp::range(void) const {
-    return fst() == NULL;
+    return holes == 0U;
   }
   forceinline bool
   IntVarImp::assigned(void) const {
@@ -256,8 +448,11 @@ namespace Gecode { namespace Int {
 
   forceinline unsigned int
   IntVarImp::regret_min(void) const {
-    if (fst() == NULL) {
+    if (range()) {
       return (dom.min() == dom.max()) ? 0U : 1U;
+    } else if (fst() == NULL) {
+      return static_cast<unsigned int>
+        (bits()->next(dom.min()+1,dom.max())-dom.min());
     } else if (dom.min() == fst()->max()) {
       return static_cast<unsigned int>(fst()->next(NULL)->min()-dom.min());
     } else {
@@ -266,8 +461,11 @@ namespace Gecode { namespace Int {
   }
   forceinline unsigned int
   IntVarImp::regret_max(void) const {
-    if (fst() == NULL) {
+    if (range()) {
       return (dom.min() == dom.max()) ? 0U : 1U;
+    } else if (fst() == NULL) {
+      return static_cast<unsigned int>
+        (dom.max()-bits()->prev(dom.max()-1,dom.min()));
     } else if (dom.max() == lst()->min()) {
       return static_cast<unsigned int>(dom.max()-lst()->prev(NULL)->max());
     } else {
@@ -286,13 +484,13 @@ namespace Gecode { namespace Int {
   IntVarImp::in(int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(n);
+    return range() || in_full(n);
   }
   forceinline bool
   IntVarImp::in(long long int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(static_cast<int>(n));
+    return range() || in_full(static_cast<int>(n));
   }
 
 
@@ -425,12 +623,20 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImpFwd::IntVarImpFwd(void) {}
-  forceinline
-  IntVarImpFwd::IntVarImpFwd(const IntVarImp* x)
-    : p(NULL), c(x->ranges_fwd()) {}
   forceinline void
   IntVarImpFwd::init(const IntVarImp* x) {
     p=NULL; c=x->ranges_fwd();
+    if (x->bitset()) {
+      b=x->bits();
+      mi=c->min(); ma=b->skip(mi,c->max())-1;
+    } else {
+      b=NULL;
+      mi=c->min(); ma=c->max();
+    }
+  }
+  forceinline
+  IntVarImpFwd::IntVarImpFwd(const IntVarImp* x) {
+    init(x);
   }
 
   forceinline bool
@@ -439,20 +645,29 @@ namespace Gecode { namespace Int {
   }
   forceinline void
   IntVarImpFwd::operator ++(void) {
-    const IntVarImp::RangeList* n=c->next(p); p=c; c=n;
+    if (b == NULL) {
+      const IntVarImp::RangeList* n=c->next(p); p=c; c=n;
+      if (c != NULL) {
+        mi=c->min(); ma=c->max();
+      }
+    } else if (ma < c->max()) {
+      mi=b->next(ma+1,c->max()); ma=b->skip(mi,c->max())-1;
+    } else {
+      c=NULL;
+    }
   }
 
   forceinline int
   IntVarImpFwd::min(void) const {
-    return c->min();
+    return mi;
   }
   forceinline int
   IntVarImpFwd::max(void) const {
-    return c->max();
+    return ma;
   }
   forceinline unsigned int
   IntVarImpFwd::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(ma-mi)+1;
   }
 
 
@@ -463,12 +678,20 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImpBwd::IntVarImpBwd(void) {}
-  forceinline
-  IntVarImpBwd::IntVarImpBwd(const IntVarImp* x)
-    : n(NULL), c(x->ranges_bwd()) {}
   forceinline void
   IntVarImpBwd::init(const IntVarImp* x) {
     n=NULL; c=x->ranges_bwd();
+    if (x->bitset()) {
+      b=x->bits();
+      ma=c->max(); mi=b->skip_prev(ma,c->min())+1;
+    } else {
+      b=NULL;
+      mi=c->min(); ma=c->max();
+    }
+  }
+  forceinline
+  IntVarImpBwd::IntVarImpBwd(const IntVarImp* x) {
+    init(x);
   }
 
   forceinline bool
@@ -477,20 +700,29 @@ namespace Gecode { namespace Int {
   }
   forceinline void
   IntVarImpBwd::operator ++(void) {
-    const IntVarImp::RangeList* p=c->prev(n); n=c; c=p;
+    if (b == NULL) {
+      const IntVarImp::RangeList* p=c->prev(n); n=c; c=p;
+      if (c != NULL) {
+        mi=c->min(); ma=c->max();
+      }
+    } else if (mi > c->min()) {
+      ma=b->prev(mi-1,c->min()); mi=b->skip_prev(ma,c->min())+1;
+    } else {
+      c=NULL;
+    }
   }
 
   forceinline int
   IntVarImpBwd::min(void) const {
-    return c->min();
+    return mi;
   }
   forceinline int
   IntVarImpBwd::max(void) const {
-    return c->max();
+    return ma;
   }
   forceinline unsigned int
   IntVarImpBwd::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(ma-mi)+1;
   }
 
 
@@ -513,11 +745,14 @@ namespace Gecode { namespace Int {
 
     // Is new domain range?
     if (!ri()) {
-      // Remove possible rangelist (if it was not a range, the domain
-      // must have been narrowed!)
+      // Remove possible rangelist or bitset (if it was not a range, the
+      // domain must have been narrowed!)
       if (fst()) {
         fst()->dispose(home,NULL,lst());
         fst(NULL); holes = 0;
+      } else if (!range()) {
+        bits()->dispose(home);
+        holes = 0;
       }
       const int min1 = dom.min(); dom.min(min0);
       const int max1 = dom.max(); dom.max(max0);
@@ -527,7 +762,42 @@ namespace Gecode { namespace Int {
       goto notify;
     }
 
-    if (depends || range()) {
+    if (range() ? (width() <= bits_max) : (fst() == NULL)) {
+      unsigned int s = static_cast<unsigned int>(max0-min0+1);
+      int f = min0;
+      if (depends || range()) {
+        // Construct new bitset (the iterator might depend on the old one)
+        BitDom* b = BitDom::allocate(home,dom.min(),dom.max(),false);
+        b->set(min0,max0);
+        do {
+          b->set(ri.min(),ri.max());
+          s += ri.width(); max0 = ri.max();
+          ++ri;
+        } while (ri());
+        if (!range())
+          bits()->dispose(home);
+        bits(b);
+      } else {
+        // Exclude values between the ranges
+        BitDom* b = bits();
+        do {
+          b->clear(max0+1,ri.min()-1);
+          s += ri.width(); max0 = ri.max();
+          ++ri;
+        } while (ri());
+      }
+
+      // Check for modification
+      if (size() == s)
+        return ME_INT_NONE;
+
+      const int min1 = dom.min(); dom.min(f);
+      const int max1 = dom.max(); dom.max(max0);
+      holes = width() - s;
+
+      me = ((f == min1) && (max0 == max1)) ? ME_INT_DOM : ME_INT_BND;
+      goto notify;
+    } else if (depends || range()) {
       // Construct new rangelist
       RangeList*   f = new (home) RangeList(min0,max0,NULL,NULL);
       RangeList*   l = f;
@@ -667,7 +937,24 @@ namespace Gecode { namespace Int {
 
   template<class I>
   forceinline ModEvent
-  IntVarImp::inter_r(Space& home, I& i, bool) {
+  IntVarImp::inter_r(Space& home, I& i, bool depends) {
+    if (!depends && bitset()) {
+      // Exclude values between the ranges
+      BitDom* b = bits();
+      int l = dom.min();
+      while (i() && (i.max() < l))
+        ++i;
+      while (i() && (i.min() <= dom.max())) {
+        if (i.min() > l)
+          b->clear(l,i.min()-1);
+        if (i.max() >= dom.max())
+          return bits_pruned(home,b);
+        l = i.max()+1;
+        ++i;
+      }
+      b->clear(l,dom.max());
+      return bits_pruned(home,b);
+    }
     IntVarImpFwd j(this);
     Iter::Ranges::Inter<I,IntVarImpFwd> ij(i,j);
     return narrow_r(home,ij,true);
@@ -704,6 +991,19 @@ namespace Gecode { namespace Int {
         (!i() || (i.min() > dom.max())))
       return gq(home,i_max+1);
 
+    if (range() ? (width() <= bits_max) : (fst() == NULL)) {
+      BitDom* b = range() ?
+        BitDom::allocate(home,dom.min(),dom.max(),true) : bits();
+      while (true) {
+        b->clear(std::max(i_min,dom.min()),std::min(i_max,dom.max()));
+        if (!i() || (i.min() > dom.max()))
+          break;
+        i_min = i.min(); i_max = i.max();
+        ++i;
+      }
+      return bits_pruned(home,b);
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
@@ -870,6 +1170,17 @@ namespace Gecode { namespace Int {
     if (!i() || (i.val() > dom.max()))
       return nq_full(home,v);
 
+    if (range() ? (width() <= bits_max) : (fst() == NULL)) {
+      BitDom* b = range() ?
+        BitDom::allocate(home,dom.min(),dom.max(),true) : bits();
+      b->clear(v);
+      while (i() && (i.val() <= dom.max())) {
+        b->clear(i.val());
+        ++i;
+      }
+      return bits_pruned(home,b);
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
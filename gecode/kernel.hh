@@ -46,6 +46,8 @@
 #include <cfloat>
 
 #include <functional>
+#include <atomic>
+#include <typeinfo>
 
 #include <gecode/support.hh>
 
@@ -108,6 +110,9 @@ namespace Gecode {
     const double chb_alpha_decrement = 1e-6;
     /// Initial value for Q-score in CHB
     const double chb_qscore_init = 0.05;
+
+    /// Minimal number of views for heap-based view selection
+    const int heap_views = 256;
   }}
 
 }
@@ -234,6 +239,7 @@ namespace Gecode {
 #include <gecode/kernel/branch/merit.hpp>
 #include <gecode/kernel/branch/filter.hpp>
 #include <gecode/kernel/branch/view-sel.hpp>
+#include <gecode/kernel/branch/view-sel-heap.hpp>
 #include <gecode/kernel/branch/print.hpp>
 #include <gecode/kernel/branch/view.hpp>
 #include <gecode/kernel/branch/val-sel.hpp>
@@ -53,6 +53,7 @@ namespace Gecode {
       _a = heap.realloc<unsigned int>(_a, _size, e._n);
       heap.copy<unsigned int>(_a,e._a,e._n);
       _size = _n = e._n;
+      _pos = e._pos;
     }
     return *this;
   }
@@ -38,7 +38,7 @@ namespace Gecode {
   Support::Mutex Action::Storage::m;
 
   Action::Storage::~Storage(void) {
-    heap.free<double>(a,n);
+    heap.free<std::atomic<double>>(a,n);
   }
 
   const Action Action::def;
@@ -58,18 +58,12 @@ namespace Gecode {
   Action::decay(Space&, double d) {
     if ((d < 0.0) || (d > 1.0))
       throw IllegalDecay("Action");
-    acquire();
-    object().invd = 1.0 / d;
-    release();
+    object().invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   double
   Action::decay(const Space&) const {
-    double d;
-    const_cast<Action*>(this)->acquire();
-    d = 1.0 / object().invd;
-    const_cast<Action*>(this)->release();
-    return d;
+    return 1.0 / object().invd.load(std::memory_order_relaxed);
   }
 
 }
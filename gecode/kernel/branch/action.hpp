@@ -38,6 +38,11 @@ namespace Gecode {
   /**
    * \brief Class for action management
    *
+   * The action values are shared by all clones (and hence all threads
+   * of a parallel search engine). They are updated with atomic
+   * operations without ordering constraints, a mutex is only used
+   * when all values must be rescaled.
+   *
    */
   class Action : public SharedHandle {
   protected:
@@ -46,20 +51,22 @@ namespace Gecode {
     /// Object for storing action values
     class GECODE_VTABLE_EXPORT Storage : public SharedHandle::Object {
     public:
-      /// Mutex to synchronize globally shared access
+      /// Mutex to synchronize rescaling
       GECODE_KERNEL_EXPORT static Support::Mutex m;
       /// Number of action values
       int n;
       /// Inverse decay factor
-      double invd;
+      std::atomic<double> invd;
       /// Action values (more follow)
-      double* a;
+      std::atomic<double>* a;
       /// Initialize action values
       template<class View>
       Storage(Home home, ViewArray<View>& x, double d,
               typename BranchTraits<typename View::VarType>::Merit bm);
       /// Update action value at position \a i
       void update(int i);
+      /// Rescale all action values if value at position \a i is too large
+      void rescale(int i);
       /// Delete object
       GECODE_KERNEL_EXPORT
       ~Storage(void);
@@ -70,10 +77,6 @@ namespace Gecode {
     void object(Storage& o);
     /// Update action value at position \a i
     void update(int i);
-    /// Acquire mutex
-    void acquire(void);
-    /// Release mutex
-    void release(void);
   public:
     /// \name Constructors and initialization
     //@{
@@ -257,15 +260,16 @@ namespace Gecode {
   Action::Storage::Storage(Home home, ViewArray<View>& x, double d,
                            typename
                            BranchTraits<typename View::VarType>::Merit bm)
-    : n(x.size()), invd(1.0 / d), a(heap.alloc<double>(x.size())) {
+    : n(x.size()), invd(1.0 / d),
+      a(heap.alloc<std::atomic<double>>(x.size())) {
     if (bm)
       for (int i=0; i<n; i++) {
         typename View::VarType xi(x[i].varimp());
-        a[i] = bm(home,xi,i);
+        a[i].store(bm(home,xi,i),std::memory_order_relaxed);
       }
     else
       for (int i=0; i<n; i++)
-        a[i] = 1.0;
+        a[i].store(1.0,std::memory_order_relaxed);
   }
   forceinline void
   Action::Storage::update(int i) {
@@ -274,10 +278,27 @@ namespace Gecode {
      * Niklas En, Niklas Srensson, SAT 2003.
      */
     assert((i >= 0) && (i < n));
-    a[i] = invd * (a[i] + 1.0);
-    if (a[i] > Kernel::Config::rescale_limit)
-      for (int j=0; j<n; j++)
-        a[j] *= Kernel::Config::rescale;
+    double d = invd.load(std::memory_order_relaxed);
+    double o = a[i].load(std::memory_order_relaxed);
+    double v;
+    do {
+      v = d * (o + 1.0);
+    } while (!a[i].compare_exchange_weak(o,v,std::memory_order_relaxed));
+    if (v > Kernel::Config::rescale_limit)
+      rescale(i);
+  }
+  forceinline void
+  Action::Storage::rescale(int i) {
+    m.acquire();
+    // Another thread might have rescaled in the meantime
+    if (a[i].load(std::memory_order_relaxed) > Kernel::Config::rescale_limit)
+      for (int j=0; j<n; j++) {
+        double o = a[j].load(std::memory_order_relaxed);
+        while (!a[j].compare_exchange_weak(o,o * Kernel::Config::rescale,
+                                           std::memory_order_relaxed))
+          ;
+      }
+    m.release();
   }
 
 
@@ -303,20 +324,12 @@ namespace Gecode {
   forceinline double
   Action::operator [](int i) const {
     assert((i >= 0) && (i < object().n));
-    return object().a[i];
+    return object().a[i].load(std::memory_order_relaxed);
   }
   forceinline int
   Action::size(void) const {
     return object().n;
   }
-  forceinline void
-  Action::acquire(void) {
-    object().m.acquire();
-  }
-  forceinline void
-  Action::release(void) {
-    object().m.release();
-  }
 
 
   forceinline
@@ -415,8 +428,6 @@ namespace Gecode {
   template<class View>
   ExecStatus
   Action::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
-    // Lock action information
-    a.acquire();
     for (Advisors<Idx> as(c); as(); ++as) {
       int i = as.advisor().idx();
       if (as.advisor().marked()) {
@@ -426,7 +437,6 @@ namespace Gecode {
           as.advisor().dispose(home,c);
       }
     }
-    a.release();
     return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
   }
 
@@ -35,8 +35,6 @@
 
 namespace Gecode {
 
-  Support::Mutex CHB::Storage::m;
-
   CHB::Storage::~Storage(void) {
     heap.free<Info>(chb,n);
   }
@@ -0,0 +1,581 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \defgroup TaskBranchViewSelHeap Heap-based view selection
+   *
+   * For merits that only depend on the domain of a view (such as
+   * domain size, minimum, maximum, or regret), the unassigned views
+   * can be kept in a binary heap ordered by merit. Ties are broken
+   * by position, hence the view selected is exactly the view that
+   * is found by scanning all views.
+   *
+   * Which views must be repositioned in the heap is recorded by
+   * an advisor-based propagator: only views that have been modified
+   * since the last selection are reconsidered. The heap is only
+   * used for at least Kernel::Config::heap_views views, for no
+   * filter function, and if no tie-breaking is requested.
+   *
+   * \ingroup TaskBranchViewVal
+   */
+  //@{
+  /// Positions of views modified since the last selection
+  class ViewSelHeapDirty : public LocalObject {
+  protected:
+    /// Number of views
+    int n;
+    /// Whether the view at a position has been modified
+    bool* m;
+    /// Positions of modified views
+    int* d;
+    /// Number of modified views
+    int n_d;
+  public:
+    /// Initialize for \a n views
+    ViewSelHeapDirty(Space& home, int n);
+    /// Copy constructor
+    ViewSelHeapDirty(Space& home, ViewSelHeapDirty& dv);
+    /// Record that view at position \a i has been modified
+    void mark(int i);
+  };
+
+  /// Handle for a local object of type \a Object used for view selection
+  template<class Object>
+  class ViewSelHeapHandle : public LocalHandle {
+  public:
+    /// Create handle for no object
+    ViewSelHeapHandle(void);
+    /// Create handle for object \a o
+    ViewSelHeapHandle(Object* o);
+    /// Copy constructor
+    ViewSelHeapHandle(const ViewSelHeapHandle<Object>& h);
+    /// Test whether handle refers to an object
+    operator bool(void) const;
+    /// Access object
+    Object* operator ->(void) const;
+    /// Updating during cloning
+    void update(Space& home, ViewSelHeapHandle<Object>& h);
+  };
+
+  /// Propagator for recording modified views
+  template<class View>
+  class ViewSelHeapRecorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Advisor with index
+    class Idx : public Advisor {
+    protected:
+      /// Position of view
+      int i;
+    public:
+      /// Constructor for creation
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Constructor for cloning \a a
+      Idx(Space& home, Idx& a);
+      /// Get position of view
+      int idx(void) const;
+    };
+    /// Where modified views are recorded
+    ViewSelHeapHandle<ViewSelHeapDirty> dv;
+    /// The advisor council
+    Council<Idx> c;
+    /// Constructor for cloning \a p
+    ViewSelHeapRecorder(Space& home, ViewSelHeapRecorder<View>& p);
+  public:
+    /// Constructor for creation
+    ViewSelHeapRecorder(Home home, ViewArray<View>& x,
+                        ViewSelHeapHandle<ViewSelHeapDirty>& dv);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home);
+    /// Cost function (record so that propagator runs last)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Record modification of a view
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x,
+                           ViewSelHeapHandle<ViewSelHeapDirty>& dv);
+  };
+
+  /// Heap of unassigned views ordered by merit
+  template<class Choose, class Val>
+  class ViewSelHeapData : public ViewSelHeapDirty {
+  protected:
+    /// How to choose
+    Choose c;
+    /// Merit of views (by position)
+    Val* v;
+    /// Heap of view positions
+    int* h;
+    /// Number of views in heap
+    int n_h;
+    /// Position in heap of views (-1 if not in heap)
+    int* p;
+    /// Test whether view at position \a i goes before view at \a j
+    bool before(int i, int j) const;
+    /// Move view at heap position \a k up
+    void up(int k);
+    /// Move view at heap position \a k down
+    void down(int k);
+  public:
+    /// Initialize for \a n views
+    ViewSelHeapData(Space& home, int n);
+    /// Copy constructor
+    ViewSelHeapData(Space& home, ViewSelHeapData<Choose,Val>& hd);
+    /// Copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Insert view at position \a i with merit \a vi
+    void insert(int i, Val vi);
+    /// Update views that have been modified
+    template<class Merit>
+    void update(Space& home, Merit& m,
+                ViewArray<typename Merit::View>& x);
+    /// Test whether heap is empty
+    bool empty(void) const;
+    /// Return position of best view
+    int top(void) const;
+  };
+
+  /// Choose view according to merit by using a heap
+  template<class Choose, class Merit>
+  class ViewSelChooseHeap : public ViewSelChoose<Choose,Merit> {
+  protected:
+    typedef typename ViewSelChoose<Choose,Merit>::Val Val;
+    typedef typename ViewSelChoose<Choose,Merit>::View View;
+    typedef typename ViewSelChoose<Choose,Merit>::Var Var;
+    using ViewSelChoose<Choose,Merit>::m;
+    /// The heap (if used)
+    ViewSelHeapHandle<ViewSelHeapData<Choose,Val>> hd;
+  public:
+    using ViewSelChoose<Choose,Merit>::select;
+    /// \name Initialization
+    //@{
+    /// Constructor for creation
+    ViewSelChooseHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelChooseHeap(Space& home, ViewSelChooseHeap<Choose,Merit>& vs);
+    /// Create heap for views \a x if there are sufficiently many
+    virtual void post(Home home, ViewArray<View>& x);
+    //@}
+    /// \name View selection
+    //@{
+    /// Select a view from \a x starting from \a s and return its position
+    virtual int select(Space& home, ViewArray<View>& x, int s);
+    //@}
+  };
+
+  /// Select view with least merit by using a heap
+  template<class Merit>
+  class ViewSelMinHeap : public ViewSelChooseHeap<ChooseMin,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMinHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+  /// Select view with largest merit by using a heap
+  template<class Merit>
+  class ViewSelMaxHeap : public ViewSelChooseHeap<ChooseMax,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+  //@}
+
+
+  /*
+   * Modified views
+   *
+   */
+  forceinline
+  ViewSelHeapDirty::ViewSelHeapDirty(Space& home, int n0)
+    : LocalObject(home), n(n0),
+      m(home.alloc<bool>(n0)), d(home.alloc<int>(n0)), n_d(0) {
+    for (int i=0; i<n; i++)
+      m[i] = false;
+  }
+  forceinline
+  ViewSelHeapDirty::ViewSelHeapDirty(Space& home, ViewSelHeapDirty& dv)
+    : LocalObject(home,dv), n(dv.n),
+      m(home.alloc<bool>(dv.n)), d(home.alloc<int>(dv.n)), n_d(dv.n_d) {
+    for (int i=0; i<n; i++)
+      m[i] = dv.m[i];
+    for (int i=0; i<n_d; i++)
+      d[i] = dv.d[i];
+  }
+  forceinline void
+  ViewSelHeapDirty::mark(int i) {
+    assert((i >= 0) && (i < n));
+    if (!m[i]) {
+      m[i] = true; d[n_d++] = i;
+    }
+  }
+
+
+  /*
+   * Handle
+   *
+   */
+  template<class Object>
+  forceinline
+  ViewSelHeapHandle<Object>::ViewSelHeapHandle(void) {}
+  template<class Object>
+  forceinline
+  ViewSelHeapHandle<Object>::ViewSelHeapHandle(Object* o)
+    : LocalHandle(o) {}
+  template<class Object>
+  forceinline
+  ViewSelHeapHandle<Object>::ViewSelHeapHandle
+  (const ViewSelHeapHandle<Object>& h)
+    : LocalHandle(h) {}
+  template<class Object>
+  forceinline
+  ViewSelHeapHandle<Object>::operator bool(void) const {
+    return object() != NULL;
+  }
+  template<class Object>
+  forceinline Object*
+  ViewSelHeapHandle<Object>::operator ->(void) const {
+    return static_cast<Object*>(object());
+  }
+  template<class Object>
+  forceinline void
+  ViewSelHeapHandle<Object>::update(Space& home,
+                                    ViewSelHeapHandle<Object>& h) {
+    if (h)
+      LocalHandle::update(home,h);
+  }
+
+
+  /*
+   * Recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  ViewSelHeapRecorder<View>::Idx::Idx(Space& home, Propagator& p,
+                                      Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+  template<class View>
+  forceinline
+  ViewSelHeapRecorder<View>::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+  template<class View>
+  forceinline int
+  ViewSelHeapRecorder<View>::Idx::idx(void) const {
+    return i;
+  }
+
+  template<class View>
+  forceinline
+  ViewSelHeapRecorder<View>::ViewSelHeapRecorder
+  (Home home, ViewArray<View>& x, ViewSelHeapHandle<ViewSelHeapDirty>& dv0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), dv(dv0), c(home) {
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+  template<class View>
+  forceinline
+  ViewSelHeapRecorder<View>::ViewSelHeapRecorder
+  (Space& home, ViewSelHeapRecorder<View>& p)
+    : NaryPropagator<View,PC_GEN_NONE>(home,p) {
+    dv.update(home,p.dv);
+    c.update(home,p.c);
+  }
+  template<class View>
+  Propagator*
+  ViewSelHeapRecorder<View>::copy(Space& home) {
+    return new (home) ViewSelHeapRecorder<View>(home,*this);
+  }
+  template<class View>
+  PropCost
+  ViewSelHeapRecorder<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::record();
+  }
+  template<class View>
+  void
+  ViewSelHeapRecorder<View>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_GEN_ASSIGNED);
+  }
+  template<class View>
+  ExecStatus
+  ViewSelHeapRecorder<View>::advise(Space& home, Advisor& a, const Delta&) {
+    Idx& ia = static_cast<Idx&>(a);
+    dv->mark(ia.idx());
+    // Assigned views are removed from the heap and need no more advice
+    if (x[ia.idx()].assigned())
+      return home.ES_NOFIX_DISPOSE(c,ia);
+    return ES_FIX;
+  }
+  template<class View>
+  ExecStatus
+  ViewSelHeapRecorder<View>::propagate(Space& home, const ModEventDelta&) {
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+  template<class View>
+  size_t
+  ViewSelHeapRecorder<View>::dispose(Space& home) {
+    c.dispose(home);
+    dv.~ViewSelHeapHandle<ViewSelHeapDirty>();
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+  template<class View>
+  forceinline ExecStatus
+  ViewSelHeapRecorder<View>::post(Home home, ViewArray<View>& x,
+                                  ViewSelHeapHandle<ViewSelHeapDirty>& dv) {
+    (void) new (home) ViewSelHeapRecorder<View>(home,x,dv);
+    return ES_OK;
+  }
+
+
+  /*
+   * Heap
+   *
+   */
+  template<class Choose, class Val>
+  forceinline
+  ViewSelHeapData<Choose,Val>::ViewSelHeapData(Space& home, int n0)
+    : ViewSelHeapDirty(home,n0),
+      v(home.alloc<Val>(n0)), h(home.alloc<int>(n0)), n_h(0),
+      p(home.alloc<int>(n0)) {
+    for (int i=0; i<n; i++)
+      p[i] = -1;
+  }
+  template<class Choose, class Val>
+  forceinline
+  ViewSelHeapData<Choose,Val>::ViewSelHeapData
+  (Space& home, ViewSelHeapData<Choose,Val>& hd)
+    : ViewSelHeapDirty(home,hd),
+      v(home.alloc<Val>(hd.n)), h(home.alloc<int>(hd.n)), n_h(hd.n_h),
+      p(home.alloc<int>(hd.n)) {
+    for (int i=0; i<n; i++) {
+      v[i] = hd.v[i]; p[i] = hd.p[i];
+    }
+    for (int k=0; k<n_h; k++)
+      h[k] = hd.h[k];
+  }
+  template<class Choose, class Val>
+  Actor*
+  ViewSelHeapData<Choose,Val>::copy(Space& home) {
+    return new (home) ViewSelHeapData<Choose,Val>(home,*this);
+  }
+  template<class Choose, class Val>
+  forceinline bool
+  ViewSelHeapData<Choose,Val>::before(int i, int j) const {
+    // Same as scanning: among views with equal merit take the first one
+    if (c(v[i],v[j]))
+      return true;
+    if (c(v[j],v[i]))
+      return false;
+    return i < j;
+  }
+  template<class Choose, class Val>
+  forceinline void
+  ViewSelHeapData<Choose,Val>::up(int k) {
+    int i = h[k];
+    while (k > 0) {
+      int l = (k - 1) >> 1;
+      if (!before(i,h[l]))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+  template<class Choose, class Val>
+  forceinline void
+  ViewSelHeapData<Choose,Val>::down(int k) {
+    int i = h[k];
+    while (true) {
+      int l = 2*k + 1;
+      if (l >= n_h)
+        break;
+      if ((l+1 < n_h) && before(h[l+1],h[l]))
+        l++;
+      if (!before(h[l],i))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+  template<class Choose, class Val>
+  forceinline void
+  ViewSelHeapData<Choose,Val>::insert(int i, Val vi) {
+    assert(p[i] < 0);
+    v[i] = vi; h[n_h] = i; up(n_h++);
+  }
+  template<class Choose, class Val>
+  template<class Merit>
+  forceinline void
+  ViewSelHeapData<Choose,Val>::update(Space& home, Merit& me,
+                                      ViewArray<typename Merit::View>& x) {
+    while (n_d > 0) {
+      int i = d[--n_d];
+      m[i] = false;
+      int k = p[i];
+      if (k < 0)
+        continue;
+      if (x[i].assigned()) {
+        // Remove from heap
+        p[i] = -1;
+        if (k < --n_h) {
+          int j = h[n_h];
+          h[k] = j; p[j] = k;
+          if (before(j,i))
+            up(k);
+          else
+            down(k);
+        }
+      } else {
+        Val vi = me(home,x[i],i);
+        bool u = c(vi,v[i]);
+        v[i] = vi;
+        if (u)
+          up(k);
+        else
+          down(k);
+      }
+    }
+  }
+  template<class Choose, class Val>
+  forceinline bool
+  ViewSelHeapData<Choose,Val>::empty(void) const {
+    return n_h == 0;
+  }
+  template<class Choose, class Val>
+  forceinline int
+  ViewSelHeapData<Choose,Val>::top(void) const {
+    assert(n_h > 0);
+    return h[0];
+  }
+
+
+  /*
+   * Heap-based view selection
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap
+  (Space& home, const VarBranch<Var>& vb)
+    : ViewSelChoose<Choose,Merit>(home,vb) {}
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap
+  (Space& home, ViewSelChooseHeap<Choose,Merit>& vs)
+    : ViewSelChoose<Choose,Merit>(home,vs) {
+    hd.update(home,vs.hd);
+  }
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::post(Home home, ViewArray<View>& x) {
+    if (x.size() < Kernel::Config::heap_views)
+      return;
+    ViewSelHeapData<Choose,Val>* d =
+      new (home) ViewSelHeapData<Choose,Val>(home,x.size());
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        d->insert(i,m(home,x[i],i));
+    hd = ViewSelHeapHandle<ViewSelHeapData<Choose,Val>>(d);
+    ViewSelHeapHandle<ViewSelHeapDirty> dv(d);
+    (void) ViewSelHeapRecorder<View>::post(home,x,dv);
+  }
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s) {
+    if (!hd)
+      return ViewSelChoose<Choose,Merit>::select(home,x,s);
+    hd->update(home,m,x);
+    assert(!hd->empty() && (hd->top() >= s));
+    return hd->top();
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vb) {}
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vs) {}
+  template<class Merit>
+  ViewSel<typename ViewSelMinHeap<Merit>::View>*
+  ViewSelMinHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMinHeap<Merit>(home,*this);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vb) {}
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vs) {}
+  template<class Merit>
+  ViewSel<typename ViewSelMaxHeap<Merit>::View>*
+  ViewSelMaxHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMaxHeap<Merit>(home,*this);
+  }
+
+}
+
+// STATISTICS: kernel-branch
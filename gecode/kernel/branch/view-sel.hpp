@@ -53,6 +53,8 @@ namespace Gecode {
     ViewSel(Space& home, const VarBranch<Var>& vb);
     /// Constructor for copying during cloning
     ViewSel(Space& home, ViewSel<View>& vs);
+    /// Initialize for views \a x when the brancher is created
+    virtual void post(Home home, ViewArray<View>& x);
     //@}
     /// \name View selection and tie breaking
     //@{
@@ -379,6 +381,9 @@ namespace Gecode {
   forceinline
   ViewSel<View>::ViewSel(Space&, ViewSel<View>&) {}
   template<class View>
+  void
+  ViewSel<View>::post(Home, ViewArray<View>&) {}
+  template<class View>
   int
   ViewSel<View>::select(Space&, ViewArray<View>&, int,
                         BrancherNoFilter<View>&) {
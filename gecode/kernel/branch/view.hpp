@@ -140,6 +140,9 @@ namespace Gecode {
     : Brancher(home), x(x0), start(0), f(bf) {
     for (int i=0; i<n; i++)
       vs[i] = vs0[i];
+    // Only a single selector without filter selects directly
+    if ((n == 1) && !f)
+      vs[0]->post(home,x);
     for (int i=0; i<n; i++)
       if (f.notice() || vs[i]->notice()) {
         home.notice(*this,AP_DISPOSE,true);
@@ -131,6 +131,8 @@ namespace Gecode {
     // Initialize propagator queues
     for (int i=0; i<=PropCost::AC_MAX; i++)
       pc.p.queue[i].init();
+    pc.p.nonempty = 0U;
+    pc.p.lifo = 0U;
     pc.p.bid_sc = (reserved_bid+1) << sc_bits;
     pc.p.n_sub  = 0;
     pc.p.vti.other();
@@ -276,17 +278,9 @@ namespace Gecode {
           if (p->u.med != 0) {
           f_unstable:
             // There is at least one propagator in a queue
-            do {
-              assert(pc.p.active >= &pc.p.queue[0]);
-              // First propagator or link back to queue
-              ActorLink* fst = pc.p.active->next();
-              if (pc.p.active != fst) {
-                p = Propagator::cast(fst);
-                goto f_execute;
-              }
-              pc.p.active--;
-            } while (true);
-            GECODE_NEVER;
+            p = scheduled();
+            assert(p != NULL);
+            goto f_execute;
           }
           // Fall through
         case ES_FIX:
@@ -296,15 +290,9 @@ namespace Gecode {
           p->unlink(); pl.head(p);
         f_stable_or_unstable:
           // There might be a propagator in the queue
-          do {
-            assert(pc.p.active >= &pc.p.queue[0]);
-            // First propagator or link back to queue
-            ActorLink* fst = pc.p.active->next();
-            if (pc.p.active != fst) {
-              p = Propagator::cast(fst);
-              goto f_execute;
-            }
-          } while (--pc.p.active >= &pc.p.queue[0]);
+          p = scheduled();
+          if (p != NULL)
+            goto f_execute;
           assert(pc.p.active < &pc.p.queue[0]);
           goto f_stable;
         case __ES_SUBSUMED:
@@ -338,17 +326,9 @@ namespace Gecode {
           if (p->u.med != 0) {
           d_unstable:
             // There is at least one propagator in a queue
-            do {
-              assert(pc.p.active >= &pc.p.queue[0]);
-              // First propagator or link back to queue
-              ActorLink* fst = pc.p.active->next();
-              if (pc.p.active != fst) {
-                p = Propagator::cast(fst);
-                goto d_execute;
-              }
-              pc.p.active--;
-            } while (true);
-            GECODE_NEVER;
+            p = scheduled();
+            assert(p != NULL);
+            goto d_execute;
           }
           // Fall through
         case ES_FIX:
@@ -359,15 +339,9 @@ namespace Gecode {
           p->unlink(); pl.head(p);
         d_stable_or_unstable:
           // There might be a propagator in the queue
-          do {
-            assert(pc.p.active >= &pc.p.queue[0]);
-            // First propagator or link back to queue
-            ActorLink* fst = pc.p.active->next();
-            if (pc.p.active != fst) {
-              p = Propagator::cast(fst);
-              goto d_execute;
-            }
-          } while (--pc.p.active >= &pc.p.queue[0]);
+          p = scheduled();
+          if (p != NULL)
+            goto d_execute;
           assert(pc.p.active < &pc.p.queue[0]);
           goto d_stable;
         case __ES_SUBSUMED:
@@ -387,10 +361,14 @@ namespace Gecode {
         // Find a non-disabled tracer recorder (possibly null)
         TraceRecorder* tr = findtracerecorder();
         ViewTraceInfo vti; vti.other();
+        // Time stamp when the current propagator started executing
+        unsigned long long int t0 = 0;
 #define GECODE_STATUS_TRACE(q,s) \
   if ((tr != NULL) && (tr->events() & TE_PROPAGATE) && \
       (tr->filter()(p->group()))) {                    \
     PropagateTraceInfo pti(p->id(),p->group(),q,       \
+                           typeid(*p),                 \
+                           Support::ticks()-t0,        \
                            PropagateTraceInfo::s);     \
     tr->tracer()._propagate(*this,pti);                \
   }
@@ -406,6 +384,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
+        t0 = Support::ticks();
         switch (p->propagate(*this,med_o)) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
@@ -416,17 +395,9 @@ namespace Gecode {
             GECODE_STATUS_TRACE(p,NOFIX);
           t_unstable:
             // There is at least one propagator in a queue
-            do {
-              assert(pc.p.active >= &pc.p.queue[0]);
-              // First propagator or link back to queue
-              ActorLink* fst = pc.p.active->next();
-              if (pc.p.active != fst) {
-                p = Propagator::cast(fst);
-                goto t_execute;
-              }
-              pc.p.active--;
-            } while (true);
-            GECODE_NEVER;
+            p = scheduled();
+            assert(p != NULL);
+            goto t_execute;
           }
           // Fall through
         case ES_FIX:
@@ -438,15 +409,9 @@ namespace Gecode {
           p->unlink(); pl.head(p);
         t_stable_or_unstable:
           // There might be a propagator in the queue
-          do {
-            assert(pc.p.active >= &pc.p.queue[0]);
-            // First propagator or link back to queue
-            ActorLink* fst = pc.p.active->next();
-            if (pc.p.active != fst) {
-              p = Propagator::cast(fst);
-              goto t_execute;
-            }
-          } while (--pc.p.active >= &pc.p.queue[0]);
+          p = scheduled();
+          if (p != NULL)
+            goto t_execute;
           assert(pc.p.active < &pc.p.queue[0]);
           goto t_stable;
         case __ES_SUBSUMED:
@@ -822,7 +787,9 @@ namespace Gecode {
     c->pc.p.active = &c->pc.p.queue[0]-1;
     for (int i=0; i<=PropCost::AC_MAX; i++)
       c->pc.p.queue[i].init();
+    c->pc.p.nonempty = 0U;
     // Copy propagation only data
+    c->pc.p.lifo   = pc.p.lifo;
     c->pc.p.n_sub  = pc.p.n_sub;
     c->pc.p.bid_sc = pc.p.bid_sc;
 
@@ -836,6 +803,16 @@ namespace Gecode {
   Space::constrain(const Space&) {
   }
 
+  void
+  Space::archive(Archive&) const {
+    throw SpaceNoArchive("Space::archive");
+  }
+
+  void
+  Space::unarchive(Archive&) {
+    throw SpaceNoArchive("Space::unarchive");
+  }
+
   bool
   Space::master(const MetaInfo& mi) {
     switch (mi.type()) {
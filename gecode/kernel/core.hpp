@@ -983,11 +983,16 @@ namespace Gecode {
     PropagatorGroup g;
     /// Propagator
     const Propagator* p;
+    /// Propagator class
+    const std::type_info& c;
+    /// Ticks spent during execution
+    unsigned long long int t;
     /// Status
     Status s;
     /// Initialize
     PropagateTraceInfo(unsigned int i, PropagatorGroup g,
-                       const Propagator* p, Status s);
+                       const Propagator* p, const std::type_info& c,
+                       unsigned long long int t, Status s);
   public:
     /// Return propagator identifier
     unsigned int id(void) const;
@@ -995,6 +1000,10 @@ namespace Gecode {
     PropagatorGroup group(void) const;
     /// Return pointer to non-subsumed propagator
     const Propagator* propagator(void) const;
+    /// Return class of propagator (also for subsumed propagators)
+    const std::type_info& type(void) const;
+    /// Return ticks (see Support::ticks) spent during execution
+    unsigned long long int ticks(void) const;
     /// Return propagator status
     Status status(void) const;
   };
@@ -1830,6 +1839,16 @@ namespace Gecode {
         ActorLink* active;
         /// Scheduled propagators according to cost
         ActorLink queue[PropCost::AC_MAX+1];
+        /**
+         * \brief Queues that might contain a propagator
+         *
+         * Bit \a i is set if queue \a i might be non-empty: it is set
+         * when a propagator is enqueued and cleared when the queue is
+         * found to be empty.
+         */
+        unsigned int nonempty;
+        /// Queues using LIFO rather than FIFO order
+        unsigned int lifo;
         /**
          * \brief Id of next brancher to be created plus status control
          *
@@ -1854,6 +1873,15 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+    /// Return the highest queue index set in non-zero bitmask \a m
+    static int highest(unsigned int m);
+    /**
+     * \brief Return next propagator to be executed (NULL if stable)
+     *
+     * Requires that \a active points to a queue. If no propagator is
+     * scheduled, \a active is set below the first queue.
+     */
+    Propagator* scheduled(void);
     /**
      * \name update, and dispose variables
      */
@@ -2033,6 +2061,30 @@ namespace Gecode {
      * \ingroup TaskModelScript
      */
     GECODE_KERNEL_EXPORT virtual void constrain(const Space& best);
+    /**
+     * \brief Archive function for checkpoints of best solution search
+     *
+     * Must archive the solution of this space into \a e such that
+     * the function unarchive can recreate it. Used when a checkpoint
+     * of a best solution search engine is written and when solutions
+     * are sent between search engines in different processes.
+     *
+     * The default function throws an exception of type SpaceNoArchive.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual void archive(Archive& e) const;
+    /**
+     * \brief Unarchive function for checkpoints of best solution search
+     *
+     * Must constrain this space (a clone of the root space) to be the
+     * solution archived in \a e by the function archive.
+     *
+     * The default function throws an exception of type SpaceNoArchive.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual void unarchive(Archive& e);
     /**
      * \brief Master configuration function for meta search engines
      *
@@ -2406,6 +2458,16 @@ namespace Gecode {
      * \ingroup TaskActor
      */
     bool stable(void) const;
+    /**
+     * \brief Set whether propagators of cost \a ac are scheduled in LIFO order
+     *
+     * By default, propagators of the same cost are executed in FIFO
+     * order. The setting is inherited by clones.
+     * \ingroup TaskActor
+     */
+    void lifo(PropCost::ActualCost ac, bool b=true);
+    /// Return whether propagators of cost \a ac are scheduled in LIFO order
+    bool lifo(PropCost::ActualCost ac) const;
 
     /// \name Conversion from Space to Home
     //@{
@@ -3376,8 +3438,11 @@ namespace Gecode {
    */
   forceinline
   PropagateTraceInfo::PropagateTraceInfo(unsigned int i0, PropagatorGroup g0,
-                                         const Propagator* p0, Status s0)
-    : i(i0), g(g0), p(p0), s(s0) {}
+                                         const Propagator* p0,
+                                         const std::type_info& c0,
+                                         unsigned long long int t0,
+                                         Status s0)
+    : i(i0), g(g0), p(p0), c(c0), t(t0), s(s0) {}
   forceinline unsigned int
   PropagateTraceInfo::id(void) const {
     return i;
@@ -3390,6 +3455,14 @@ namespace Gecode {
   PropagateTraceInfo::propagator(void) const {
     return p;
   }
+  forceinline const std::type_info&
+  PropagateTraceInfo::type(void) const {
+    return c;
+  }
+  forceinline unsigned long long int
+  PropagateTraceInfo::ticks(void) const {
+    return t;
+  }
   forceinline PropagateTraceInfo::Status
   PropagateTraceInfo::status(void) const {
     return s;
@@ -3523,7 +3596,7 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().get();
   }
 
 #ifdef GECODE_HAS_CBS
@@ -4020,12 +4093,60 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
-    c->tail(ActorLink::cast(p));
+    unsigned int ac = p->cost(*this,p->u.med).ac;
+    ActorLink* c = &pc.p.queue[ac];
+    if (pc.p.lifo & (1U << ac))
+      c->head(ActorLink::cast(p));
+    else
+      c->tail(ActorLink::cast(p));
+    pc.p.nonempty |= 1U << ac;
     if (c > pc.p.active)
       pc.p.active = c;
   }
 
+  forceinline int
+  Space::highest(unsigned int m) {
+    assert(m != 0U);
+#if defined(__GNUC__)
+    return static_cast<int>(sizeof(unsigned int)*8U - 1U) - __builtin_clz(m);
+#else
+    int i = PropCost::AC_MAX;
+    while (!(m & (1U << i)))
+      i--;
+    return i;
+#endif
+  }
+
+  forceinline Propagator*
+  Space::scheduled(void) {
+    assert(pc.p.active >= &pc.p.queue[0]);
+    while (true) {
+      // First propagator or link back to queue
+      ActorLink* fst = pc.p.active->next();
+      if (pc.p.active != fst)
+        return Propagator::cast(fst);
+      // Queue is empty, jump to the next queue that might be non-empty
+      pc.p.nonempty &= ~(1U << (pc.p.active - &pc.p.queue[0]));
+      if (pc.p.nonempty == 0U) {
+        pc.p.active = &pc.p.queue[0]-1;
+        return NULL;
+      }
+      pc.p.active = &pc.p.queue[highest(pc.p.nonempty)];
+    }
+  }
+
+  forceinline void
+  Space::lifo(PropCost::ActualCost ac, bool b) {
+    if (b)
+      pc.p.lifo |= 1U << ac;
+    else
+      pc.p.lifo &= ~(1U << ac);
+  }
+  forceinline bool
+  Space::lifo(PropCost::ActualCost ac) const {
+    return (pc.p.lifo & (1U << ac)) != 0U;
+  }
+
   forceinline void
   Space::fail(void) {
     pc.p.active = &pc.p.queue[PropCost::AC_MAX+1]+1;
@@ -47,6 +47,9 @@ namespace Gecode {
   SpaceNoBrancher::SpaceNoBrancher(const char* l)
     : Exception(l,"Attempt to commit with no brancher") {}
 
+  SpaceNoArchive::SpaceNoArchive(const char* l)
+    : Exception(l,"Space does not support archiving solutions") {}
+
   SpaceIllegalAlternative::SpaceIllegalAlternative(const char* l)
     : Exception(l,"Attempt to commit with illegal alternative") {}
 
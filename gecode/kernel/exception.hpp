@@ -68,6 +68,13 @@ namespace Gecode {
     SpaceNoBrancher(const char* l);
   };
 
+  /// %Exception: Space does not support archiving solutions
+  class GECODE_KERNEL_EXPORT SpaceNoArchive : public Exception {
+  public:
+    /// Initialize with location \a l
+    SpaceNoArchive(const char* l);
+  };
+
   /// %Exception: Commit with illegal alternative
   class GECODE_KERNEL_EXPORT SpaceIllegalAlternative : public Exception {
   public:
@@ -35,7 +35,15 @@
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The afc values are shared by all spaces (and hence all threads
+   * of a parallel search engine). Failures update them with atomic
+   * operations without ordering constraints. The mutex is only
+   * needed for allocating information and for the rare case that
+   * all afc values must be rescaled.
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -46,9 +54,13 @@ namespace Gecode { namespace Kernel {
       /// Group identifier
       unsigned int gid;
       /// The afc value
-      double afc;
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
+      /// Return afc value
+      double get(void) const;
+      /// Multiply afc value by \a s
+      void scale(double s);
     };
   private:
     /// Block of propagator information
@@ -70,7 +82,7 @@ namespace Gecode { namespace Kernel {
     /// The current block
     Block* b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int npid;
     /// Whether to unshare
@@ -79,6 +91,8 @@ namespace Gecode { namespace Kernel {
     Block fst;
     /// Mutex to synchronize globally shared access
     GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Rescale all afc values if the afc value of \a c is too large
+    void rescale(Info& c);
   public:
     /// Initialize
     GPI(void);
@@ -103,7 +117,19 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0,std::memory_order_relaxed);
+  }
+
+  forceinline double
+  GPI::Info::get(void) const {
+    return afc.load(std::memory_order_relaxed);
+  }
+
+  forceinline void
+  GPI::Info::scale(double s) {
+    double o = afc.load(std::memory_order_relaxed);
+    while (!afc.compare_exchange_weak(o, o*s, std::memory_order_relaxed))
+      ;
   }
 
 
@@ -114,7 +140,7 @@ namespace Gecode { namespace Kernel {
   forceinline void
   GPI::Block::rescale(void) {
     for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+      info[i].scale(Kernel::Config::rescale);
   }
 
 
@@ -123,22 +149,30 @@ namespace Gecode { namespace Kernel {
     : b(&fst), invd(1.0), npid(0U), us(false) {}
 
   forceinline void
-  GPI::fail(Info& c) {
+  GPI::rescale(Info& c) {
     m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
+    // Another thread might have rescaled in the meantime
+    if (c.get() > Kernel::Config::rescale_limit)
       for (Block* i = b; i != NULL; i = i->next)
         i->rescale();
     m.release();
   }
 
+  forceinline void
+  GPI::fail(Info& c) {
+    double d = invd.load(std::memory_order_relaxed);
+    double o = c.afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = d * (o + 1.0);
+    } while (!c.afc.compare_exchange_weak(o, n, std::memory_order_relaxed));
+    if (n > Kernel::Config::rescale_limit)
+      rescale(c);
+  }
+
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline unsigned int
@@ -161,9 +195,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
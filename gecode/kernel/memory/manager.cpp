@@ -35,9 +35,88 @@
 
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex& SharedMemory::m(void) {
-    static Support::Mutex _m;
-    return _m;
+  namespace {
+
+    /// Mutex for access to the collection of thread caches
+    Support::Mutex& m(void) {
+      static Support::Mutex _m;
+      return _m;
+    }
+
+    /// All thread caches currently in use (protected by m())
+    SharedMemory::ThreadCache* caches = NULL;
+
+    /// Statistics of thread caches already destroyed
+    SharedMemory::Statistics retired;
+
+    /// The thread cache (trivially destructible so it outlives its guard)
+    thread_local SharedMemory::ThreadCache cache;
+
+    /// Whether the thread cache has been registered
+    thread_local bool cache_used = false;
+
+    /// Whether the thread cache has been destroyed
+    thread_local bool cache_dead = false;
+
+    /// Releases the thread cache when the thread terminates
+    class CacheGuard {
+    public:
+      /// Register thread cache
+      CacheGuard(void);
+      /// Release cached heap chunks and unregister thread cache
+      ~CacheGuard(void);
+    };
+
+    CacheGuard::CacheGuard(void) {
+      cache.n_hc = 0; cache.hc = NULL;
+      cache.hit = 0; cache.miss = 0; cache.contention = 0;
+      Support::Lock l(m());
+      cache.next = caches; caches = &cache;
+    }
+
+    CacheGuard::~CacheGuard(void) {
+      cache_dead = true;
+      while (cache.hc != NULL) {
+        HeapChunk* hc = cache.hc;
+        cache.hc = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.rfree(hc);
+      }
+      cache.n_hc = 0;
+      Support::Lock l(m());
+      retired.hit += cache.hit;
+      retired.miss += cache.miss;
+      retired.contention += cache.contention;
+      SharedMemory::ThreadCache** c = &caches;
+      while (*c != &cache)
+        c = &(*c)->next;
+      *c = cache.next;
+    }
+
+  }
+
+  SharedMemory::ThreadCache*
+  SharedMemory::tc(void) {
+    if (cache_used)
+      return cache_dead ? NULL : &cache;
+    if (cache_dead)
+      return NULL;
+    cache_used = true;
+    // Creating the guard registers the cache
+    static thread_local CacheGuard g;
+    (void) g;
+    return &cache;
+  }
+
+  SharedMemory::Statistics
+  SharedMemory::statistics(void) {
+    Support::Lock l(m());
+    Statistics s(retired);
+    for (ThreadCache* c = caches; c != NULL; c = c->next) {
+      s.hit += c->hit.load(std::memory_order_relaxed);
+      s.miss += c->miss.load(std::memory_order_relaxed);
+      s.contention += c->contention.load(std::memory_order_relaxed);
+    }
+    return s;
   }
 
   void
@@ -58,16 +58,66 @@ namespace Gecode { namespace Kernel {
 
   /// Shared object for several memory areas
   class SharedMemory {
-  private:
-    /// The components for shared heap memory
-    struct {
-      /// How many heap chunks are available for caching
+  public:
+    /// Statistics for caching heap chunks
+    class Statistics {
+    public:
+      /// Number of heap chunks served from a thread-local cache
+      unsigned long int hit;
+      /// Number of heap chunk requests not served from a thread-local cache
+      unsigned long int miss;
+      /// Number of failed attempts to update the shared heap chunk pool
+      unsigned long int contention;
+      /// Initialize with all counters being zero
+      Statistics(void);
+      /// Reset all counters to zero
+      void reset(void);
+      /// Add statistics \a s
+      Statistics& operator +=(const Statistics& s);
+    };
+    /**
+     * \brief Heap chunks cached by a single thread
+     *
+     * The cache is only accessed by the thread owning it, hence
+     * no synchronization is needed. The statistics counters are
+     * atomic only so that they can be read safely by other threads.
+     */
+    class ThreadCache {
+    public:
+      /// How many heap chunks are cached
       unsigned int n_hc;
       /// A list of cached heap chunks
       HeapChunk* hc;
+      /// Counter for hits
+      std::atomic<unsigned long int> hit;
+      /// Counter for misses
+      std::atomic<unsigned long int> miss;
+      /// Counter for contention
+      std::atomic<unsigned long int> contention;
+      /// Next thread cache (for collecting statistics)
+      ThreadCache* next;
+      /// Increment counter \a c (only called by the owning thread)
+      static void inc(std::atomic<unsigned long int>& c);
+    };
+  private:
+    /// The components for shared heap memory
+    struct {
+      /// How many heap chunks are available for caching (approximately)
+      std::atomic<unsigned int> n_hc;
+      /// A lock-free list of cached heap chunks
+      std::atomic<HeapChunk*> hc;
     } heap;
-    /// A mutex for access
-    GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /**
+     * \brief Return the cache of the calling thread
+     *
+     * Returns NULL if the cache of the calling thread has already
+     * been destroyed (that is, the thread is terminating).
+     */
+    GECODE_KERNEL_EXPORT static ThreadCache* tc(void);
+    /// Release heap chunk \a hc to the shared pool
+    void release(HeapChunk* hc, ThreadCache* c);
+    /// Try to acquire a heap chunk of size at least \a l from the shared pool
+    HeapChunk* acquire(size_t l, ThreadCache* c);
   public:
     /// Initialize
     SharedMemory(void);
@@ -80,6 +130,8 @@ namespace Gecode { namespace Kernel {
     /// Free heap chunk (or cache for later)
     void free(HeapChunk* hc);
     //@}
+    /// Return heap chunk caching statistics summed over all threads
+    GECODE_KERNEL_EXPORT static Statistics statistics(void);
   };
 
 
@@ -180,50 +232,118 @@ namespace Gecode { namespace Kernel {
    *
    */
 
+  forceinline
+  SharedMemory::Statistics::Statistics(void)
+    : hit(0), miss(0), contention(0) {}
+  forceinline void
+  SharedMemory::Statistics::reset(void) {
+    hit=0; miss=0; contention=0;
+  }
+  forceinline SharedMemory::Statistics&
+  SharedMemory::Statistics::operator +=(const Statistics& s) {
+    hit += s.hit; miss += s.miss; contention += s.contention;
+    return *this;
+  }
+
+  forceinline void
+  SharedMemory::ThreadCache::inc(std::atomic<unsigned long int>& c) {
+    // Only the owning thread writes, so no read-modify-write is needed
+    c.store(c.load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+  }
+
   forceinline
   SharedMemory::SharedMemory(void) {
-    heap.n_hc = 0;
-    heap.hc = NULL;
+    heap.n_hc.store(0,std::memory_order_relaxed);
+    heap.hc.store(NULL,std::memory_order_release);
   }
   forceinline
   SharedMemory::~SharedMemory(void) {
-    while (heap.hc != NULL) {
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
+    HeapChunk* hc = heap.hc.load(std::memory_order_acquire);
+    while (hc != NULL) {
+      HeapChunk* t = hc;
+      hc = static_cast<HeapChunk*>(hc->next);
+      Gecode::heap.rfree(t);
+    }
+  }
+
+  forceinline void
+  SharedMemory::release(HeapChunk* hc, ThreadCache* c) {
+    if (heap.n_hc.load(std::memory_order_relaxed) >= MemoryConfig::n_hc_cache) {
       Gecode::heap.rfree(hc);
+      return;
     }
+    heap.n_hc.fetch_add(1,std::memory_order_relaxed);
+    HeapChunk* h = heap.hc.load(std::memory_order_relaxed);
+    do {
+      hc->next = h;
+      if (heap.hc.compare_exchange_weak(h,hc,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed))
+        return;
+      if (c != NULL)
+        ThreadCache::inc(c->contention);
+    } while (true);
+  }
+
+  forceinline HeapChunk*
+  SharedMemory::acquire(size_t l, ThreadCache* c) {
+    // Take the entire pool at once: this avoids the ABA problem
+    HeapChunk* hc = heap.hc.exchange(NULL,std::memory_order_acquire);
+    HeapChunk* found = NULL;
+    unsigned int n = 0;
+    while (hc != NULL) {
+      HeapChunk* t = hc;
+      hc = static_cast<HeapChunk*>(hc->next);
+      n++;
+      if ((found == NULL) && (t->size >= l)) {
+        found = t;
+      } else if ((c != NULL) && (t->size >= l) &&
+                 (c->n_hc < MemoryConfig::n_hc_cache)) {
+        c->n_hc++;
+        t->next = c->hc; c->hc = t;
+      } else {
+        Gecode::heap.rfree(t);
+      }
+    }
+    if (n > 0)
+      heap.n_hc.fetch_sub(n,std::memory_order_relaxed);
+    return found;
   }
 
   forceinline HeapChunk*
   SharedMemory::alloc(size_t s, size_t l) {
-    // To protect from exceptions from heap.ralloc()
-    Support::Lock guard(m());
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
+    ThreadCache* c = tc();
+    if (c != NULL) {
+      while ((c->hc != NULL) && (c->hc->size < l)) {
+        c->n_hc--;
+        HeapChunk* hc = c->hc;
+        c->hc = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.rfree(hc);
+      }
+      if (c->hc != NULL) {
+        ThreadCache::inc(c->hit);
+        c->n_hc--;
+        HeapChunk* hc = c->hc;
+        c->hc = static_cast<HeapChunk*>(hc->next);
+        return hc;
+      }
+      ThreadCache::inc(c->miss);
     }
-    HeapChunk* hc;
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
+    HeapChunk* hc = acquire(l,c);
+    if (hc == NULL) {
       hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
       hc->size = s;
-    } else {
-      heap.n_hc--;
-      hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
     }
     return hc;
   }
   forceinline void
   SharedMemory::free(HeapChunk* hc) {
-    Support::Lock guard(m());
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
+    ThreadCache* c = tc();
+    if ((c != NULL) && (c->n_hc < MemoryConfig::n_hc_cache)) {
+      c->n_hc++;
+      hc->next = c->hc; c->hc = hc;
     } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
+      release(hc,c);
     }
   }
 
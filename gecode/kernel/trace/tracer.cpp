@@ -33,6 +33,19 @@
 
 #include <gecode/kernel.hh>
 
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
 namespace Gecode {
 
   Support::Mutex TracerBase::m;
@@ -63,6 +76,137 @@ namespace Gecode {
 
   StdTracer StdTracer::def;
 
+
+  /*
+   * Profiler
+   *
+   */
+
+  /// Profile information per propagator class and group
+  class Profiler::Table {
+  public:
+    /// Information per propagator class
+    std::map<std::type_index,Entry> c;
+    /// Information per propagator group (by group identifier)
+    std::map<unsigned int,Entry> g;
+    /// Information for all propagators
+    Entry a;
+  };
+
+  namespace {
+
+    /// Entry with a name to be printed
+    typedef std::pair<std::string,Profiler::Entry> NamedEntry;
+
+    /// Order entries by decreasing time spent
+    bool
+    slower(const NamedEntry& x, const NamedEntry& y) {
+      return x.second.ticks > y.second.ticks;
+    }
+
+    /// Return readable name for mangled type name \a tn
+    std::string
+    demangle(const char* tn) {
+#ifdef __GNUC__
+      int status = 0;
+      char* n = abi::__cxa_demangle(tn, NULL, NULL, &status);
+      if ((status == 0) && (n != NULL)) {
+        std::string s(n);
+        free(n);
+        return s;
+      }
+#endif
+      return tn;
+    }
+
+    /// Print entries \a es with heading \a what
+    void
+    entries(std::ostream& os, const char* prefix, const char* what,
+          std::vector<NamedEntry>& es, const Profiler::Entry& a) {
+      std::stable_sort(es.begin(), es.end(), slower);
+      os << prefix << what << std::endl
+         << prefix << "  "
+         << std::setw(12) << "propagate" << std::setw(12) << "fix"
+         << std::setw(12) << "nofix" << std::setw(10) << "subsumed"
+         << std::setw(10) << "failed" << std::setw(8) << "time%"
+         << "  name" << std::endl;
+      for (std::vector<NamedEntry>::const_iterator i = es.begin();
+           i != es.end(); ++i) {
+        const Profiler::Entry& e = i->second;
+        double t = (a.ticks > 0ULL) ?
+          (100.0 * static_cast<double>(e.ticks) /
+           static_cast<double>(a.ticks)) : 0.0;
+        std::ostringstream p;
+        p << std::fixed << std::setprecision(2) << t;
+        os << prefix << "  "
+           << std::setw(12) << e.propagate << std::setw(12) << e.fix
+           << std::setw(12) << e.nofix << std::setw(10) << e.subsumed
+           << std::setw(10) << e.failed << std::setw(8) << p.str()
+           << "  " << i->first << std::endl;
+      }
+    }
+
+  }
+
+  Profiler::Profiler(void) : t(new Table) {}
+
+  void
+  Profiler::propagate(const Space&, const PropagateTraceInfo& pti) {
+    t->c[std::type_index(pti.type())].add(pti);
+    t->g[pti.group().id()].add(pti);
+    t->a.add(pti);
+  }
+
+  void
+  Profiler::commit(const Space&, const CommitTraceInfo&) {}
+
+  void
+  Profiler::post(const Space&, const PostTraceInfo&) {}
+
+  Profiler::Entry
+  Profiler::total(void) const {
+    m.acquire();
+    Entry a = t->a;
+    m.release();
+    return a;
+  }
+
+  void
+  Profiler::reset(void) {
+    m.acquire();
+    delete t;
+    t = new Table;
+    m.release();
+  }
+
+  void
+  Profiler::print(std::ostream& os, const char* prefix) const {
+    std::vector<NamedEntry> gs, cs;
+    m.acquire();
+    Entry a = t->a;
+    for (std::map<unsigned int,Entry>::const_iterator i = t->g.begin();
+         i != t->g.end(); ++i) {
+      std::ostringstream n;
+      if (i->first == Group::def.id())
+        n << "default";
+      else
+        n << "g:" << i->first;
+      gs.push_back(NamedEntry(n.str(),i->second));
+    }
+    for (std::map<std::type_index,Entry>::const_iterator i = t->c.begin();
+         i != t->c.end(); ++i)
+      cs.push_back(NamedEntry(demangle(i->first.name()),i->second));
+    m.release();
+    os << prefix << "profile:      " << a.propagate << " propagations, "
+       << a.ticks << " ticks" << std::endl;
+    entries(os, prefix, "per group", gs, a);
+    entries(os, prefix, "per propagator class", cs, a);
+  }
+
+  Profiler::~Profiler(void) {
+    delete t;
+  }
+
 }
 
 // STATISTICS: kernel-trace
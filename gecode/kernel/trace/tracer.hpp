@@ -243,6 +243,77 @@ namespace Gecode {
   };
 
 
+  /**
+   * \brief Tracer profiling propagator executions
+   *
+   * For each propagator class and each propagator group the profiler
+   * records the number of executions, how they ended (fixpoint, no
+   * fixpoint, subsumed, failed), and the time spent in ticks (see
+   * Support::ticks). A single profiler can be shared by all spaces
+   * of a (parallel) search, the information is then aggregated over
+   * all threads.
+   *
+   * A profiler is installed as any other tracer, that is
+   * \code trace(home, TE_PROPAGATE, profiler); \endcode
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_KERNEL_EXPORT Profiler : public Tracer {
+  public:
+    /// Profile information for a propagator class or group
+    class Entry {
+    public:
+      /// Number of executions
+      unsigned long int propagate;
+      /// Number of executions resulting in a fixpoint
+      unsigned long int fix;
+      /// Number of executions not resulting in a fixpoint
+      unsigned long int nofix;
+      /// Number of executions resulting in subsumption
+      unsigned long int subsumed;
+      /// Number of executions resulting in failure
+      unsigned long int failed;
+      /// Ticks spent during all executions
+      unsigned long long int ticks;
+      /// Initialize with all counts being zero
+      Entry(void);
+      /// Account for execution described by \a pti
+      void add(const PropagateTraceInfo& pti);
+    };
+  protected:
+    /// Class for storing profile information (hides the implementation)
+    class Table;
+    /// The profile information
+    Table* t;
+  public:
+    /// Initialize
+    Profiler(void);
+    /// Record execution of propagator
+    virtual void propagate(const Space& home,
+                           const PropagateTraceInfo& pti);
+    /// Ignore commit operations
+    virtual void commit(const Space& home,
+                        const CommitTraceInfo& cti);
+    /// Ignore propagator posting
+    virtual void post(const Space& home,
+                      const PostTraceInfo& pti);
+    /// Return accumulated profile information for all propagators
+    Entry total(void) const;
+    /// Discard all profile information
+    void reset(void);
+    /**
+     * \brief Print profile information to \a os
+     *
+     * The information per propagator group and per propagator class
+     * is printed in decreasing order of time spent, each line starts
+     * with \a prefix.
+     */
+    void print(std::ostream& os, const char* prefix = "\t") const;
+    /// Destructor
+    virtual ~Profiler(void);
+  };
+
+
   /*
    * View tracer
    */
@@ -335,6 +406,28 @@ namespace Gecode {
   Tracer::~Tracer(void) {
   }
 
+
+  /*
+   * Profiler
+   */
+
+  forceinline
+  Profiler::Entry::Entry(void)
+    : propagate(0UL), fix(0UL), nofix(0UL), subsumed(0UL), failed(0UL),
+      ticks(0ULL) {}
+
+  forceinline void
+  Profiler::Entry::add(const PropagateTraceInfo& pti) {
+    propagate++; ticks += pti.ticks();
+    switch (pti.status()) {
+    case PropagateTraceInfo::FIX:      fix++;      break;
+    case PropagateTraceInfo::NOFIX:    nofix++;    break;
+    case PropagateTraceInfo::SUBSUMED: subsumed++; break;
+    case PropagateTraceInfo::FAILED:   failed++;   break;
+    default: GECODE_NEVER;
+    }
+  }
+
 }
 
 // STATISTICS: kernel-trace
@@ -75,6 +75,15 @@
 #include <gecode/support/auto-link.hpp>
 #endif
 
+/*
+ * Configure support for worker processes
+ *
+ */
+#if defined(GECODE_HAS_UNISTD_H) && !defined(_WIN32)
+/// Whether search engines can use worker processes
+#define GECODE_HAS_PROCESSES
+#endif
+
 
 namespace Gecode { namespace Search {
 
@@ -108,6 +117,8 @@ namespace Gecode { namespace Search {
     const bool clone = true;
     /// Number of threads to use
     const double threads = 1.0;
+    /// Whether to pin threads to processing units
+    const bool affinity = false;
 
     /// Create a clone after every \a c_d commits (commit distance)
     const unsigned int c_d = 8;
@@ -118,6 +129,10 @@ namespace Gecode { namespace Search {
     const unsigned int steal_limit = 3;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
+    /// Number of unsuccessful stealing rounds before an idle worker backs off
+    const unsigned int steal_spin = 4;
+    /// Maximal delay in milliseconds for an idle worker backing off
+    const unsigned int steal_backoff = 4;
 
     /// Default discrepancy limit for LDS
     const unsigned int d_l = 5;
@@ -130,6 +145,18 @@ namespace Gecode { namespace Search {
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
 
+    /// Number of subproblems per worker for decomposition
+    const unsigned int subproblems = 32;
+    /// Number of nodes after which a worker checks for messages or better solutions
+    const unsigned int poll = 256;
+    /// Timeout in milliseconds for checking the stop object with worker processes
+    const int proc_timeout = 10;
+    /// Number of nodes a worker explores per epoch in deterministic parallel search
+    const unsigned int epoch = 1024;
+
+    /// Version of the checkpoint format
+    const unsigned int checkpoint_version = 1;
+
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
   }
@@ -336,6 +363,8 @@ namespace Gecode {
     void _skip(const EdgeInfo& ei);
     /// The engine creates a new node with information \a ei and \a ni
     void _node(const EdgeInfo& ei, const NodeInfo& ni);
+    /// The worker \a wid explores subproblem \a sid in epoch \a e
+    void _schedule(unsigned int wid, unsigned int e, unsigned int sid);
     //@}
   public:
     /// Initialize
@@ -361,6 +390,13 @@ namespace Gecode {
     virtual void skip(const EdgeInfo& ei) = 0;
     /// The engine creates a new node with information \a ei and \a ni
     virtual void node(const EdgeInfo& ei, const NodeInfo& ni) = 0;
+    /**
+     * \brief The worker \a wid explores subproblem \a sid in epoch \a e
+     *
+     * Only used by deterministic parallel search (see
+     * Search::Options::parallel). The default does nothing.
+     */
+    virtual void schedule(unsigned int wid, unsigned int e, unsigned int sid);
     /// All workers are done
     virtual void done(void) = 0;
     //@}
@@ -385,6 +421,8 @@ namespace Gecode {
     virtual void skip(const EdgeInfo& ei);
     /// The engine creates a new node with information \a ei and \a ni
     virtual void node(const EdgeInfo& ei, const NodeInfo& ni);
+    /// The worker \a wid explores subproblem \a sid in epoch \a e
+    virtual void schedule(unsigned int wid, unsigned int e, unsigned int sid);
     /// All workers are done
     virtual void done(void);
     /// Delete
@@ -706,6 +744,13 @@ namespace Gecode { namespace Search {
 
     class Stop;
 
+    /// How parallel search distributes work between threads
+    enum ParallelMode {
+      PM_STEAL, ///< Idle workers steal work from other workers
+      PM_EPS,   ///< Workers explore subproblems of a decomposition (EPS)
+      PM_DET    ///< Workers explore subproblems in synchronized epochs
+    };
+
     /**
      * \brief %Search engine options
      *
@@ -741,6 +786,34 @@ namespace Gecode { namespace Search {
      * \f$n \times m\f$ threads are chosen. If \f$-1 <n<0\f$,
      * \f$(1+n)\times m\f$ threads are chosen.
      *
+     * If \a processes is not zero, depth-first and branch-and-bound
+     * search run with that many worker processes (if supported by the
+     * platform, see GECODE_HAS_PROCESSES), each of which uses a single
+     * thread. The search tree is decomposed into at least \a subproblems
+     * subproblems per worker (if the tree is large enough). Subproblems
+     * are sent to the workers as paths of archived choices and solutions
+     * are sent back by the functions Space::archive and
+     * Space::unarchive which must be implemented by the model.
+     *
+     * If \a parallel is PM_EPS, parallel depth-first and branch-and-bound
+     * search use embarrassingly parallel search: the search tree is
+     * decomposed into at least \a subproblems subproblems per thread
+     * before search starts and each thread explores one subproblem at a
+     * time. If in addition \a replay is true, the solutions are returned
+     * in an order that only depends on the number of threads (for
+     * branch-and-bound, better solutions are then not shared between
+     * subproblems). Tracing is not supported by embarrassingly parallel
+     * search.
+     *
+     * If \a parallel is PM_DET, parallel depth-first and branch-and-bound
+     * search are deterministic: the subproblems of a decomposition are
+     * explored in epochs of Config::epoch nodes per thread, subproblems
+     * are assigned and solutions are collected in order of the threads,
+     * and better solutions are only shared between epochs. Hence, the
+     * solutions and the statistics only depend on the number of
+     * threads. A tracer is informed about the schedule (see
+     * SearchTracer::schedule) but not about the nodes explored.
+     *
      * \ingroup TaskModelSearch
      */
     class Options {
@@ -749,6 +822,8 @@ namespace Gecode { namespace Search {
       bool clone;
       /// Number of threads to use
       double threads;
+      /// Whether to pin threads to processing units
+      bool affinity;
       /// Create a clone after every \a c_d commits (commit distance)
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
@@ -761,6 +836,16 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Whether the engine must support checkpoints
+      bool checkpoint;
+      /// Number of worker processes (0 for no worker processes)
+      unsigned int processes;
+      /// Number of subproblems per worker for decomposition
+      unsigned int subproblems;
+      /// How parallel search distributes work between threads
+      ParallelMode parallel;
+      /// Whether parallel search returns solutions in reproducible order
+      bool replay;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
@@ -910,6 +995,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods (the no-goods are empty)
     virtual NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a a (raises exception)
+    virtual void checkpoint(Archive& a) const;
+    /// Restore search state from checkpoint \a a (raises exception)
+    virtual void restore(Archive& a);
     /// Destructor
     virtual ~Engine(void);
   };
@@ -939,6 +1028,26 @@ namespace Gecode { namespace Search {
     virtual Statistics statistics(void) const;
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /**
+     * \brief Write checkpoint of search state to \a a
+     *
+     * The checkpoint contains the path of choices from the root to the
+     * open nodes of the search tree (and the best solution for best
+     * solution search, see Space::archive). Checkpoints are only
+     * supported by sequential depth-first and branch-and-bound
+     * engines that have been created with the checkpoint option set,
+     * otherwise an exception of type Search::NoCheckpoint is thrown.
+     */
+    virtual void checkpoint(Archive& a) const;
+    /**
+     * \brief Restore search state from checkpoint \a a
+     *
+     * The engine must have been created from a space for the same
+     * model as the engine that wrote the checkpoint and no solution
+     * must have been requested yet. Throws an exception of type
+     * Search::InvalidCheckpoint if \a a does not match the engine.
+     */
+    virtual void restore(Archive& a);
     /// Destructor
     virtual ~Base(void);
   private:
@@ -35,14 +35,24 @@
 #include <gecode/search/support.hh>
 
 #include <gecode/search/seq/bab.hh>
+#ifdef GECODE_HAS_PROCESSES
+#include <gecode/search/proc/engine.hh>
+#endif
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/par/bab.hh>
+#include <gecode/search/eps/engine.hh>
+#include <gecode/search/det/engine.hh>
 #endif
 
 namespace Gecode { namespace Search {
 
   Engine*
   babengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_PROCESSES
+    // Worker processes are not used by restart-based and portfolio search
+    if ((o.processes > 0) && (o.cutoff == nullptr) && (o.assets == 0))
+      return new Proc::Engine(s,o,true);
+#endif
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0) {
@@ -51,6 +61,12 @@ namespace Gecode { namespace Search {
       else
         return new WorkerToEngine<Seq::BAB<NoTraceRecorder>>(s,to);
     } else {
+      if ((to.parallel == PM_EPS) &&
+          (to.cutoff == nullptr) && (to.assets == 0))
+        return new EPS::Engine(s,to,true);
+      if ((to.parallel == PM_DET) &&
+          (to.cutoff == nullptr) && (to.assets == 0))
+        return new Det::Engine(s,to,true);
       if (to.tracer)
         return new Par::BAB<EdgeTraceRecorder>(s,to);
       else
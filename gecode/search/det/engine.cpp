@@ -0,0 +1,337 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/det/engine.hh>
+
+#ifdef GECODE_HAS_THREADS
+
+namespace Gecode { namespace Search { namespace Det {
+
+  /*
+   * Worker
+   */
+  forceinline
+  Engine::Worker::EpochStop::EpochStop(void) : n(0UL) {}
+
+  bool
+  Engine::Worker::EpochStop::stop(const Statistics&, const Options&) {
+    if (n == 0UL)
+      return true;
+    n--;
+    return false;
+  }
+
+  Engine::Worker::Worker(Engine& e0, Space* r)
+    : e(e0), root(r), cur(NULL), assigned(false), job(0), version(0UL) {}
+
+  forceinline bool
+  Engine::Worker::busy(void) const {
+    return assigned || (cur != NULL);
+  }
+
+  forceinline void
+  Engine::Worker::assign(const Subproblem& s, size_t j) {
+    sp = s; job = j; assigned = true;
+  }
+
+  forceinline size_t
+  Engine::Worker::subproblem(void) const {
+    return job;
+  }
+
+  forceinline void
+  Engine::Worker::start(void) {
+    go.signal();
+  }
+
+  Statistics
+  Engine::Worker::statistics(void) const {
+    Statistics s(done);
+    if (cur != NULL)
+      s += cur->statistics();
+    return s;
+  }
+
+  void
+  Engine::Worker::run(void) {
+    Options o(e.opt());
+    o.clone = false;
+    o.threads = 1.0;
+    o.processes = 0;
+    o.stop = &es;
+    o.tracer = nullptr;
+    while (true) {
+      go.wait();
+      if (e.terminate())
+        return;
+      if (assigned) {
+        Space* s = sp.space(*root);
+        cur = e.bab ? babengine(s,o) : dfsengine(s,o);
+        assigned = false;
+        version = 0UL;
+      }
+      if (cur != NULL) {
+        e.update(*cur,version);
+        es.n = Config::epoch;
+        while (true) {
+          if (Space* s = cur->next()) {
+            found.push_back(s);
+          } else {
+            if (!cur->stopped()) {
+              done += cur->statistics();
+              delete cur; cur = NULL;
+            }
+            break;
+          }
+        }
+      }
+      e.arrive();
+    }
+  }
+
+  Support::Terminator*
+  Engine::Worker::terminator(void) const {
+    return &e;
+  }
+
+  Engine::Worker::~Worker(void) {
+    for (Space* s : found)
+      delete s;
+    delete cur;
+    delete root;
+  }
+
+
+  /*
+   * Engine: synchronization
+   */
+  forceinline const Options&
+  Engine::opt(void) const {
+    return _opt;
+  }
+
+  void
+  Engine::update(Search::Engine& e, unsigned long int& v) {
+    // The best solution only changes between epochs
+    if (bab && (best != NULL) && (v != best_version)) {
+      // Workers must not access the best solution concurrently
+      m.acquire();
+      e.constrain(*best);
+      m.release();
+      v = best_version;
+    }
+  }
+
+  void
+  Engine::arrive(void) {
+    m.acquire();
+    bool all = (++n_arrived == workers.size());
+    m.release();
+    if (all)
+      e_arrived.signal();
+  }
+
+  bool
+  Engine::terminate(void) const {
+    return terminating;
+  }
+
+  void
+  Engine::terminated(void) {
+    unsigned int n;
+    m.acquire();
+    n = --n_not_terminated;
+    m.release();
+    // The signal must be outside of the look, otherwise a thread might be
+    // terminated that still holds a mutex.
+    if (n == 0)
+      e_terminated.signal();
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  Engine::Engine(Space* s, const Options& o, bool b)
+    : _opt(o), bab(b), n_next(0), epoch(0U), best(NULL), best_version(0UL),
+      has_stopped(false), terminating(false), n_arrived(0U),
+      n_not_terminated(0U) {
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      stat.fail++;
+      if (!o.clone)
+        delete s;
+      return;
+    }
+    Space* root = snapshot(s,o);
+    unsigned int n = std::max(static_cast<unsigned int>(o.threads),1U);
+    std::deque<Subproblem> q;
+    q.push_back(Subproblem());
+    decompose(*root, q, n * std::max(o.subproblems,1U), stat, solutions,
+              bab ? &best : NULL);
+    if (q.empty()) {
+      delete root;
+      return;
+    }
+    jobs.assign(q.begin(),q.end());
+    if (best != NULL)
+      best_version = 1UL;
+    n = std::min(n,static_cast<unsigned int>(jobs.size()));
+    n_not_terminated = n;
+    if (o.tracer != nullptr) {
+      for (unsigned int i=0; i<n; i++)
+        recorders.push_back(new TraceRecorder(o.tracer));
+      recorders[0]->engine(bab ? SearchTracer::EngineType::BAB :
+                           SearchTracer::EngineType::DFS, n);
+      for (unsigned int i=0; i<n; i++)
+        recorders[i]->worker();
+    }
+    for (unsigned int i=0; i<n; i++) {
+      // Each worker needs its own root as cloning modifies the original
+      Space* r = (i+1 < n) ? root->clone() : root;
+      workers.push_back(new Worker(*this,r));
+    }
+    for (Worker* w : workers)
+      Support::Thread::run(w);
+  }
+
+
+  /*
+   * Engine: search
+   */
+  Space*
+  Engine::next(void) {
+    has_stopped = false;
+    while (true) {
+      if (!solutions.empty()) {
+        Space* s = solutions.front();
+        solutions.pop_front();
+        return s;
+      }
+      // Assign subproblems to idle workers in order
+      bool busy = false;
+      for (unsigned int i=0; i<workers.size(); i++) {
+        if (!workers[i]->busy() && (n_next < jobs.size())) {
+          workers[i]->assign(jobs[n_next],n_next);
+          n_next++;
+        }
+        busy |= workers[i]->busy();
+      }
+      if (!busy)
+        return NULL;
+      if ((_opt.stop != nullptr) && _opt.stop->stop(statistics(),_opt)) {
+        has_stopped = true;
+        return NULL;
+      }
+      if (!recorders.empty())
+        for (unsigned int i=0; i<workers.size(); i++)
+          if (workers[i]->busy())
+            recorders[i]->schedule(epoch,
+                                   static_cast<unsigned int>
+                                   (workers[i]->subproblem()));
+      // Run an epoch
+      n_arrived = 0U;
+      for (Worker* w : workers)
+        w->start();
+      e_arrived.wait();
+      epoch++;
+      // Merge solutions in order of workers
+      for (Worker* w : workers) {
+        for (Space* s : w->found) {
+          if (bab) {
+            if (best != NULL) {
+              Space* c = s->clone();
+              c->constrain(*best);
+              bool better = (c->status() != SS_FAILED);
+              delete c;
+              if (!better) {
+                delete s;
+                continue;
+              }
+              delete best;
+            }
+            best = s->clone();
+            best_version++;
+          }
+          solutions.push_back(s);
+        }
+        w->found.clear();
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Engine::statistics(void) const {
+    Statistics s(stat);
+    for (Worker* w : workers)
+      s += w->statistics();
+    return s;
+  }
+
+  bool
+  Engine::stopped(void) const {
+    return has_stopped;
+  }
+
+  void
+  Engine::constrain(const Space& b) {
+    if (!bab)
+      throw NoBest("Det::Engine::constrain");
+    if (best != NULL) {
+      best->constrain(b);
+      if (best->status() != SS_FAILED)
+        return;
+      delete best;
+    }
+    best = b.clone();
+    best_version++;
+  }
+
+  Engine::~Engine(void) {
+    if (!workers.empty()) {
+      terminating = true;
+      for (Worker* w : workers)
+        w->start();
+      e_terminated.wait();
+    }
+    for (TraceRecorder* r : recorders) {
+      r->done();
+      delete r;
+    }
+    delete best;
+    while (!solutions.empty()) {
+      delete solutions.front();
+      solutions.pop_front();
+    }
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-det
@@ -0,0 +1,183 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_DET_ENGINE_HH__
+#define __GECODE_SEARCH_DET_ENGINE_HH__
+
+#include <deque>
+#include <vector>
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/subproblem.hh>
+
+namespace Gecode { namespace Search { namespace Det {
+
+  /**
+   * \brief Deterministic parallel search engine
+   *
+   * The engine decomposes the search tree into subproblems (see
+   * Subproblem and decompose) and explores them with worker threads in
+   * epochs. At the start of an epoch, idle workers are assigned the next
+   * subproblems in order of their worker ids. During an epoch, each
+   * worker explores at most Config::epoch nodes of its subproblem. At the
+   * end of an epoch, the solutions found are merged in order of the
+   * workers and better solutions (for best solution search) are only
+   * shared with the workers at the start of the next epoch.
+   *
+   * As a consequence, the sequence of solutions and the statistics only
+   * depend on the number of threads and not on their timing. If a
+   * tracer is used, it is informed about which worker explores which
+   * subproblem in every epoch (see SearchTracer::schedule).
+   */
+  class Engine : public Search::Engine, public Support::Terminator {
+  protected:
+    /// Worker thread exploring subproblems
+    class Worker : public Support::Runnable {
+    protected:
+      /// Stop object limiting the number of nodes explored in an epoch
+      class EpochStop : public Stop {
+      public:
+        /// Number of nodes still to be explored in current epoch
+        unsigned long int n;
+        /// Initialize
+        EpochStop(void);
+        /// Stop if no nodes are left in the current epoch
+        virtual bool stop(const Statistics& s, const Options& o);
+      };
+      /// Reference to engine
+      Engine& e;
+      /// Root space of the worker
+      Space* root;
+      /// Stop object for sequential engines
+      EpochStop es;
+      /// Sequential engine for current subproblem (NULL if none)
+      Search::Engine* cur;
+      /// Whether a subproblem has been assigned but not yet started
+      bool assigned;
+      /// Subproblem assigned to worker
+      Subproblem sp;
+      /// Index of subproblem assigned to worker
+      size_t job;
+      /// Version of the best solution the current engine is constrained by
+      unsigned long int version;
+      /// Statistics of finished subproblems
+      Statistics done;
+      /// Event to start an epoch
+      Support::Event go;
+    public:
+      /// Solutions found in the current epoch
+      std::vector<Space*> found;
+      /// Initialize for engine \a e0 with root space \a r
+      Worker(Engine& e0, Space* r);
+      /// Test whether worker is exploring or has been assigned a subproblem
+      bool busy(void) const;
+      /// Assign subproblem \a s with index \a j
+      void assign(const Subproblem& s, size_t j);
+      /// Return index of subproblem assigned to worker
+      size_t subproblem(void) const;
+      /// Start the next epoch
+      void start(void);
+      /// Return statistics
+      Statistics statistics(void) const;
+      /// Start execution of worker
+      virtual void run(void);
+      /// Terminator (engine)
+      virtual Support::Terminator* terminator(void) const;
+      /// Destructor
+      virtual ~Worker(void);
+    };
+    /// Search options
+    Options _opt;
+    /// Whether best solution search is performed
+    bool bab;
+    /// Subproblems
+    std::vector<Subproblem> jobs;
+    /// Index of next subproblem to be assigned
+    size_t n_next;
+    /// The workers
+    std::vector<Worker*> workers;
+    /// Trace recorders for the workers (if tracing)
+    std::vector<TraceRecorder*> recorders;
+    /// Current epoch
+    unsigned int epoch;
+    /// Solutions not yet returned
+    std::deque<Space*> solutions;
+    /// Best solution so far
+    Space* best;
+    /// Version of best solution
+    unsigned long int best_version;
+    /// Statistics of decomposition
+    Statistics stat;
+    /// Whether engine has been stopped
+    bool has_stopped;
+    /// Whether workers must terminate
+    bool terminating;
+    /// Mutex for synchronization at the end of an epoch
+    Support::Mutex m;
+    /// Number of workers that have finished the current epoch
+    unsigned int n_arrived;
+    /// Event for all workers having finished the current epoch
+    Support::Event e_arrived;
+    /// Number of not yet terminated workers
+    unsigned int n_not_terminated;
+    /// Event for termination (all threads have terminated)
+    Support::Event e_terminated;
+  public:
+    /// Provide access to search options
+    const Options& opt(void) const;
+    /// Constrain \a e by best solution if newer than version \a v
+    void update(Search::Engine& e, unsigned long int& v);
+    /// Report that worker has finished the current epoch
+    void arrive(void);
+    /// Return whether workers must terminate
+    bool terminate(void) const;
+    /// For worker to register termination
+    virtual void terminated(void);
+
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s with options \a o (best solution search if \a b)
+    Engine(Space* s, const Options& o, bool b);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~Engine(void);
+    //@}
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-det
@@ -35,14 +35,24 @@
 #include <gecode/search/support.hh>
 
 #include <gecode/search/seq/dfs.hh>
+#ifdef GECODE_HAS_PROCESSES
+#include <gecode/search/proc/engine.hh>
+#endif
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/par/dfs.hh>
+#include <gecode/search/eps/engine.hh>
+#include <gecode/search/det/engine.hh>
 #endif
 
 namespace Gecode { namespace Search {
 
   Engine*
   dfsengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_PROCESSES
+    // Worker processes are not used by restart-based and portfolio search
+    if ((o.processes > 0) && (o.cutoff == nullptr) && (o.assets == 0))
+      return new Proc::Engine(s,o,false);
+#endif
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0) {
@@ -51,6 +61,12 @@ namespace Gecode { namespace Search {
       else
         return new WorkerToEngine<Seq::DFS<NoTraceRecorder>>(s,to);
     } else {
+      if ((to.parallel == PM_EPS) &&
+          (to.cutoff == nullptr) && (to.assets == 0))
+        return new EPS::Engine(s,to,false);
+      if ((to.parallel == PM_DET) &&
+          (to.cutoff == nullptr) && (to.assets == 0))
+        return new Det::Engine(s,to,false);
       if (to.tracer)
         return new Par::DFS<EdgeTraceRecorder>(s,to);
       else
@@ -48,6 +48,16 @@ namespace Gecode { namespace Search {
   Engine::nogoods(void) {
     return NoGoods::eng;
   }
+  void
+  Engine::checkpoint(Archive& a) const {
+    (void) a;
+    throw NoCheckpoint("Engine::checkpoint");
+  }
+  void
+  Engine::restore(Archive& a) {
+    (void) a;
+    throw NoCheckpoint("Engine::restore");
+  }
 
 }}
 
@@ -0,0 +1,457 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/eps/engine.hh>
+
+#ifdef GECODE_HAS_THREADS
+
+namespace Gecode { namespace Search { namespace EPS {
+
+  /*
+   * Engine: command and wait handling
+   */
+  forceinline Engine::Cmd
+  Engine::cmd(void) const {
+    return _cmd;
+  }
+  forceinline void
+  Engine::block(void) {
+    _cmd = C_WAIT;
+    _m_wait.acquire();
+  }
+  forceinline void
+  Engine::release(Cmd c) {
+    _cmd = c;
+    _m_wait.release();
+  }
+  forceinline void
+  Engine::wait(void) {
+    _m_wait.acquire(); _m_wait.release();
+  }
+
+  forceinline const Options&
+  Engine::opt(void) const {
+    return _opt;
+  }
+
+
+  /*
+   * Worker
+   */
+  forceinline
+  Engine::Worker::WorkerStop::WorkerStop(Worker& w0)
+    : w(w0), n(0U), user(false) {}
+
+  bool
+  Engine::Worker::WorkerStop::stop(const Statistics& s, const Options&) {
+    if (w.e.cmd() != C_WORK)
+      return true;
+    const Options& o = w.e.opt();
+    if ((o.stop != nullptr) && o.stop->stop(w.done + s, o)) {
+      user = true;
+      return true;
+    }
+    if (++n >= Config::poll) {
+      n = 0U;
+      return w.e.newer(w.version);
+    }
+    return false;
+  }
+
+  Engine::Worker::Worker(Engine& e0, Space* r)
+    : e(e0), root(r), ws(*this), cur(NULL), job(0), version(0UL) {}
+
+  void
+  Engine::Worker::publish(void) {
+    Statistics s = cur->statistics();
+    Statistics d;
+    d.fail = s.fail - published.fail;
+    d.node = s.node - published.node;
+    d.propagate = s.propagate - published.propagate;
+    d.depth = s.depth;
+    e.report(d);
+    published = s;
+  }
+
+  void
+  Engine::Worker::run(void) {
+    Options o(e.opt());
+    o.clone = false;
+    o.threads = 1.0;
+    o.processes = 0;
+    o.stop = &ws;
+    o.tracer = nullptr;
+    while (true) {
+      switch (e.cmd()) {
+      case C_WAIT:
+        e.wait();
+        break;
+      case C_TERMINATE:
+        return;
+      case C_WORK:
+        if (cur == NULL) {
+          Subproblem sp;
+          if (!e.subproblem(sp,job)) {
+            // Thread will be terminated by returning from run
+            e.idle();
+            return;
+          }
+          Space* s = sp.space(*root);
+          cur = e.bab ? babengine(s,o) : dfsengine(s,o);
+          published = Statistics();
+          version = 0UL;
+          e.update(*cur,version);
+        }
+        if (Space* s = cur->next()) {
+          e.solution(s,job);
+        } else if (cur->stopped()) {
+          publish();
+          if (ws.user) {
+            ws.user = false;
+            e.stop();
+          }
+          e.update(*cur,version);
+        } else {
+          publish();
+          done += cur->statistics();
+          delete cur; cur = NULL;
+          e.explore(job);
+        }
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    }
+  }
+
+  Support::Terminator*
+  Engine::Worker::terminator(void) const {
+    return &e;
+  }
+
+  Engine::Worker::~Worker(void) {
+    delete cur;
+    delete root;
+  }
+
+
+  /*
+   * Engine: search control
+   */
+  bool
+  Engine::subproblem(Subproblem& s, size_t& j) {
+    m_search.acquire();
+    bool t = (n_next < jobs.size());
+    if (t) {
+      j = n_next++;
+      s = jobs[j];
+    }
+    m_search.release();
+    return t;
+  }
+
+  void
+  Engine::explore(size_t j) {
+    if (!replay)
+      return;
+    m_search.acquire();
+    explored[j] = true;
+    if (j == n_replay)
+      e_search.signal();
+    m_search.release();
+  }
+
+  void
+  Engine::idle(void) {
+    m_search.acquire();
+    if (--n_busy == 0)
+      e_search.signal();
+    m_search.release();
+  }
+
+  void
+  Engine::stop(void) {
+    m_search.acquire();
+    has_stopped = true;
+    e_search.signal();
+    m_search.release();
+  }
+
+  void
+  Engine::solution(Space* s, size_t j) {
+    m_search.acquire();
+    if (replay) {
+      found[j].push_back(s);
+      if (j == n_replay)
+        e_search.signal();
+    } else {
+      if (bab) {
+        if (best != NULL) {
+          // Another worker might have found a better solution meanwhile
+          Space* c = s->clone();
+          c->constrain(*best);
+          bool better = (c->status() != SS_FAILED);
+          delete c;
+          if (!better) {
+            delete s;
+            m_search.release();
+            return;
+          }
+          delete best;
+        }
+        best = s->clone();
+        best_version++;
+      }
+      solutions.push_back(s);
+      e_search.signal();
+    }
+    m_search.release();
+  }
+
+  bool
+  Engine::newer(unsigned long int v) const {
+    return best_version.load() != v;
+  }
+
+  void
+  Engine::update(Search::Engine& e, unsigned long int& v) {
+    if (!bab || !newer(v))
+      return;
+    m_search.acquire();
+    if (best != NULL)
+      e.constrain(*best);
+    v = best_version.load();
+    m_search.release();
+  }
+
+  void
+  Engine::report(const Statistics& s) {
+    m_search.acquire();
+    stat += s;
+    m_search.release();
+  }
+
+  bool
+  Engine::take(Space*& s) {
+    if (!solutions.empty()) {
+      s = solutions.front(); solutions.pop_front();
+      return true;
+    }
+    if (!replay)
+      return false;
+    while (n_replay < jobs.size()) {
+      std::deque<Space*>& f = found[n_replay];
+      while (!f.empty()) {
+        Space* t = f.front(); f.pop_front();
+        if (bab) {
+          if (last != NULL) {
+            // Return only solutions better than the last one returned
+            Space* c = t->clone();
+            c->constrain(*last);
+            bool better = (c->status() != SS_FAILED);
+            delete c;
+            if (!better) {
+              delete t;
+              continue;
+            }
+            delete last;
+          }
+          last = t->clone();
+        }
+        s = t;
+        return true;
+      }
+      if (!explored[n_replay])
+        return false;
+      n_replay++;
+    }
+    return false;
+  }
+
+
+  /*
+   * Engine: termination control
+   */
+  void
+  Engine::terminated(void) {
+    unsigned int n;
+    _m_term.acquire();
+    n = --_n_not_terminated;
+    _m_term.release();
+    // The signal must be outside of the look, otherwise a thread might be
+    // terminated that still holds a mutex.
+    if (n == 0)
+      _e_terminate.signal();
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  Engine::Engine(Space* s, const Options& o, bool b)
+    : _opt(o), bab(b), replay(o.replay), n_next(0), n_replay(0),
+      last(NULL), best(NULL), best_version(0UL), n_busy(0),
+      has_stopped(false), _n_not_terminated(0) {
+    block();
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      stat.fail++;
+      if (!o.clone)
+        delete s;
+      return;
+    }
+    Space* root = snapshot(s,o);
+    unsigned int n = std::max(static_cast<unsigned int>(o.threads),1U);
+    std::deque<Subproblem> q;
+    q.push_back(Subproblem());
+    decompose(*root, q, n * std::max(o.subproblems,1U), stat, solutions,
+              bab ? &best : NULL);
+    if (q.empty()) {
+      delete root;
+      return;
+    }
+    jobs.assign(q.begin(),q.end());
+    if (best != NULL) {
+      best_version = 1UL;
+      if (replay)
+        last = best->clone();
+    }
+    if (replay) {
+      found.resize(jobs.size());
+      explored.resize(jobs.size(),false);
+    }
+    n = std::min(n,static_cast<unsigned int>(jobs.size()));
+    n_busy = n;
+    _n_not_terminated = n;
+    for (unsigned int i=0; i<n; i++) {
+      // Each worker needs its own root as cloning modifies the original
+      Space* r = (i+1 < n) ? root->clone() : root;
+      Support::Thread::run(new Worker(*this,r));
+    }
+  }
+
+
+  /*
+   * Engine: search
+   */
+  Space*
+  Engine::next(void) {
+    // Invariant: the engine holds the wait mutex
+    m_search.acquire();
+    Space* s;
+    if (take(s)) {
+      // No search needs to be done, take leftover solution
+      m_search.release();
+      return s;
+    }
+    // We ignore stopped (it will be reported again if needed)
+    has_stopped = false;
+    // No more solutions?
+    if (n_busy == 0) {
+      m_search.release();
+      return NULL;
+    }
+    m_search.release();
+    // Okay, now search has to continue, make the guys work
+    release(C_WORK);
+    while (true) {
+      e_search.wait();
+      m_search.acquire();
+      if (take(s)) {
+        m_search.release();
+        // Make workers wait again
+        block();
+        return s;
+      }
+      // No more solutions or stopped?
+      if ((n_busy == 0) || has_stopped) {
+        m_search.release();
+        // Make workers wait again
+        block();
+        return NULL;
+      }
+      m_search.release();
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Engine::statistics(void) const {
+    m_search.acquire();
+    Statistics s = stat;
+    m_search.release();
+    return s;
+  }
+
+  bool
+  Engine::stopped(void) const {
+    return has_stopped;
+  }
+
+  void
+  Engine::constrain(const Space& b) {
+    if (!bab)
+      throw NoBest("EPS::Engine::constrain");
+    m_search.acquire();
+    if (best != NULL) {
+      best->constrain(b);
+      if (best->status() == SS_FAILED) {
+        delete best;
+        best = NULL;
+      }
+    }
+    if (best == NULL) {
+      best = b.clone();
+      best_version++;
+    }
+    m_search.release();
+  }
+
+  Engine::~Engine(void) {
+    // Terminate all workers that have not run out of subproblems
+    release(C_TERMINATE);
+    // Workers have been started if there are subproblems
+    if (!jobs.empty())
+      _e_terminate.wait();
+    delete best;
+    delete last;
+    while (!solutions.empty()) {
+      delete solutions.front();
+      solutions.pop_front();
+    }
+    for (std::deque<Space*>& f : found)
+      while (!f.empty()) {
+        delete f.front();
+        f.pop_front();
+      }
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-eps
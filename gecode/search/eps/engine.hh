@@ -0,0 +1,224 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_EPS_ENGINE_HH__
+#define __GECODE_SEARCH_EPS_ENGINE_HH__
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/subproblem.hh>
+
+namespace Gecode { namespace Search { namespace EPS {
+
+  /**
+   * \brief Embarrassingly parallel search engine
+   *
+   * The engine decomposes the search tree into subproblems (see
+   * Subproblem and decompose) before search starts. Worker threads then
+   * take subproblems in order from a shared list and explore each of
+   * them with a sequential engine. For best solution search, each better
+   * solution is shared with all workers.
+   *
+   * With the option replay, solutions are returned in the order of the
+   * subproblems they belong to, so that the sequence of solutions only
+   * depends on the number of threads. For best solution search, better
+   * solutions are then not shared between subproblems.
+   */
+  class Engine : public Search::Engine, public Support::Terminator {
+  protected:
+    /// Worker thread exploring subproblems
+    class Worker : public Support::Runnable {
+    protected:
+      /// Stop object for the sequential engine of a worker
+      class WorkerStop : public Stop {
+      protected:
+        /// The worker
+        Worker& w;
+        /// Number of calls since last check for a better solution
+        unsigned int n;
+      public:
+        /// Whether the stop object of the user has stopped search
+        bool user;
+        /// Initialize for worker \a w0
+        WorkerStop(Worker& w0);
+        /// Stop if engine does not work, user stops, or better solution exists
+        virtual bool stop(const Statistics& s, const Options& o);
+      };
+      /// Reference to engine
+      Engine& e;
+      /// Root space of the worker
+      Space* root;
+      /// Stop object for sequential engines
+      WorkerStop ws;
+      /// Sequential engine for current subproblem (NULL if none)
+      Search::Engine* cur;
+      /// Index of current subproblem
+      size_t job;
+      /// Statistics of finished subproblems
+      Statistics done;
+      /// Statistics of current subproblem already added to the engine
+      Statistics published;
+      /// Version of the best solution the current engine is constrained by
+      unsigned long int version;
+      /// Add statistics of current subproblem to engine
+      void publish(void);
+    public:
+      /// Initialize for engine \a e0 with root space \a r
+      Worker(Engine& e0, Space* r);
+      /// Start execution of worker
+      virtual void run(void);
+      /// Terminator (engine)
+      virtual Support::Terminator* terminator(void) const;
+      /// Destructor
+      virtual ~Worker(void);
+    };
+    /// Search options
+    Options _opt;
+    /// Whether best solution search is performed
+    bool bab;
+    /// Whether solutions are returned in order of subproblems
+    bool replay;
+    /// Subproblems
+    std::vector<Subproblem> jobs;
+
+    /// \name Commands from engine to workers and wait management
+    //@{
+  public:
+    /// Commands from engine to workers
+    enum Cmd {
+      C_WORK,     ///< Perform work
+      C_WAIT,     ///< Run into wait lock
+      C_TERMINATE ///< Terminate
+    };
+  protected:
+    /// The current command
+    volatile Cmd _cmd;
+    /// Mutex for forcing workers to wait
+    Support::Mutex _m_wait;
+  public:
+    /// Return current command
+    Cmd cmd(void) const;
+    /// Block all workers
+    void block(void);
+    /// Release all workers
+    void release(Cmd c);
+    /// Ensure that worker waits
+    void wait(void);
+    //@}
+
+    /// \name Search control
+    //@{
+  protected:
+    /// Mutex for search
+    mutable Support::Mutex m_search;
+    /// Event for search (solution found, no more solutions, search stopped)
+    Support::Event e_search;
+    /// Index of next subproblem to be taken by a worker
+    size_t n_next;
+    /// Solutions (in order of subproblems if replay is used)
+    std::deque<Space*> solutions;
+    /// Solutions for each subproblem (if replay is used)
+    std::vector<std::deque<Space*>> found;
+    /// Whether subproblem has been explored (if replay is used)
+    std::vector<bool> explored;
+    /// Index of subproblem whose solutions are returned next (if replay is used)
+    size_t n_replay;
+    /// Last solution returned (for best solution search with replay)
+    Space* last;
+    /// Best solution so far (from decomposition only if replay is used)
+    Space* best;
+    /// Version of best solution
+    std::atomic<unsigned long int> best_version;
+    /// Number of workers that have not yet run out of subproblems
+    unsigned int n_busy;
+    /// Whether a worker had been stopped
+    bool has_stopped;
+    /// Statistics
+    Statistics stat;
+    /// Take next solution to be returned, if any
+    bool take(Space*& s);
+  public:
+    /// Provide access to search options
+    const Options& opt(void) const;
+    /// Take subproblem for worker, return false if none is left
+    bool subproblem(Subproblem& s, size_t& j);
+    /// Report that worker has explored subproblem \a j
+    void explore(size_t j);
+    /// Report that worker has run out of subproblems
+    void idle(void);
+    /// Report that worker has been stopped
+    void stop(void);
+    /// Report solution \a s for subproblem \a j
+    void solution(Space* s, size_t j);
+    /// Constrain \a e by best solution if newer than version \a v
+    void update(Search::Engine& e, unsigned long int& v);
+    /// Return whether best solution is newer than version \a v
+    bool newer(unsigned long int v) const;
+    /// Add statistics \a s
+    void report(const Statistics& s);
+    //@}
+
+    /// \name Termination control
+    //@{
+  protected:
+    /// Mutex for access to termination information
+    Support::Mutex _m_term;
+    /// Number of not yet terminated workers
+    unsigned int _n_not_terminated;
+    /// Event for termination (all threads have terminated)
+    Support::Event _e_terminate;
+  public:
+    /// For worker to register termination
+    virtual void terminated(void);
+    //@}
+
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s with options \a o (best solution search if \a b)
+    Engine(Space* s, const Options& o, bool b);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~Engine(void);
+    //@}
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-eps
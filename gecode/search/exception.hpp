@@ -62,6 +62,18 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Checkpoints are not supported
+  class GECODE_SEARCH_EXPORT NoCheckpoint : public Exception {
+  public:
+    /// Initialize with location \a l
+    NoCheckpoint(const char* l);
+  };
+  /// %Exception: Checkpoint does not match engine
+  class GECODE_SEARCH_EXPORT InvalidCheckpoint : public Exception {
+  public:
+    /// Initialize with location \a l
+    InvalidCheckpoint(const char* l);
+  };
   //@}
 }}
 
@@ -36,10 +36,12 @@ namespace Gecode { namespace Search {
   forceinline
   Options::Options(void)
     : clone(Config::clone),
-      threads(Config::threads),
+      threads(Config::threads), affinity(Config::affinity),
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
-      assets(0), slice(Config::slice), nogoods_limit(0),
+      assets(0), slice(Config::slice), nogoods_limit(0), checkpoint(false),
+      processes(0), subproblems(Config::subproblems),
+      parallel(PM_STEAL), replay(false),
       stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
 
 }}
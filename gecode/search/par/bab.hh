@@ -76,10 +76,19 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::n_steal_fail;
+      using Engine<Tracer>::Worker::backoff;
+      using Engine<Tracer>::Worker::propagate;
+      using Engine<Tracer>::Worker::pin;
+      using Engine<Tracer>::Worker::memnode;
+      using Engine<Tracer>::Worker::propagating;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Whether a better solution arrived while propagating
+      bool pending;
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
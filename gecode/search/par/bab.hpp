@@ -58,6 +58,7 @@ namespace Gecode { namespace Search { namespace Par {
     d = 0;
     mark = 0;
     idle = false;
+    pending = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -74,7 +75,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   BAB<Tracer>::Worker::Worker(Space* s, BAB& e)
-    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL) {}
+    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL), pending(false) {}
 
   template<class Tracer>
   forceinline
@@ -93,8 +94,10 @@ namespace Gecode { namespace Search { namespace Par {
     // Block all workers
     block();
     // Create and start threads
-    for (unsigned int i=0U; i<workers(); i++)
+    for (unsigned int i=0U; i<workers(); i++) {
+      _worker[i]->place(i);
       Support::Thread::run(_worker[i]);
+    }
   }
 
 
@@ -108,8 +111,13 @@ namespace Gecode { namespace Search { namespace Par {
     delete best;
     best = b->clone();
     mark = path.entries();
-    if (cur != NULL)
-      cur->constrain(*best);
+    if (cur != NULL) {
+      if (propagating)
+        // The worker constrains the current space after propagation
+        pending = true;
+      else
+        cur->constrain(*best);
+    }
     m.release();
   }
   template<class Tracer>
@@ -147,9 +155,18 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   BAB<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    // Start with a random victim to spread out the thieves
+    unsigned int o = rnd(n);
+    // Whether some victim had work but could not be robbed right now
+    bool busy = false;
+    // Prefer victims on the same memory node: first pass is for those
+    for (unsigned int p=0U; p<2U; p++)
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+i) % n);
+      if ((wi == this) || ((wi->memnode() == memnode()) != (p == 0U)))
+        continue;
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -164,10 +181,14 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        n_steal_fail = 0U;
         m.release();
         return;
       }
+      busy = busy || wi->stealable();
     }
+    if (!busy)
+      backoff();
   }
 
   /*
@@ -223,6 +244,8 @@ namespace Gecode { namespace Search { namespace Par {
      *   betterness is guaranteed.
      *
      */
+    // Pin to processing unit, if requested
+    pin();
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
@@ -276,7 +299,12 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              /*
+               * Propagate without holding the mutex: the current space
+               * is not on the path, so thieves can steal meanwhile.
+               */
+              SpaceStatus ss = propagate();
+              switch (ss) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
@@ -284,6 +312,7 @@ namespace Gecode { namespace Search { namespace Par {
                   tracer.node(ei,ni);
                 }
                 fail++;
+                pending = false;
                 delete cur;
                 cur = NULL;
                 path.next();
@@ -296,6 +325,8 @@ namespace Gecode { namespace Search { namespace Par {
                                               tracer.wid(), nid, *cur);
                     tracer.node(ei,ni);
                   }
+                  // The solution is checked against the best solution
+                  pending = false;
                   // Deletes all pending branchers
                   (void) cur->choice();
                   Space* s = cur->clone();
@@ -323,6 +354,12 @@ namespace Gecode { namespace Search { namespace Par {
                     tracer.node(ei,ni);
                   }
                   cur->commit(*ch,0);
+                  if (pending) {
+                    // The clone on the path is not guaranteed to be better
+                    mark = path.entries();
+                    cur->constrain(*best);
+                    pending = false;
+                  }
                   m.release();
                 }
                 break;
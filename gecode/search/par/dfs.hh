@@ -76,6 +76,12 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::n_steal_fail;
+      using Engine<Tracer>::Worker::backoff;
+      using Engine<Tracer>::Worker::propagate;
+      using Engine<Tracer>::Worker::pin;
+      using Engine<Tracer>::Worker::memnode;
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, DFS& e);
       /// Provide access to engine
@@ -72,8 +72,10 @@ namespace Gecode { namespace Search { namespace Par {
     // Block all workers
     block();
     // Create and start threads
-    for (unsigned int i=0U; i<workers(); i++)
+    for (unsigned int i=0U; i<workers(); i++) {
+      _worker[i]->place(i);
       Support::Thread::run(_worker[i]);
+    }
   }
 
 
@@ -121,9 +123,18 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   DFS<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    // Start with a random victim to spread out the thieves
+    unsigned int o = rnd(n);
+    // Whether some victim had work but could not be robbed right now
+    bool busy = false;
+    // Prefer victims on the same memory node: first pass is for those
+    for (unsigned int p=0U; p<2U; p++)
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+i) % n);
+      if ((wi == this) || ((wi->memnode() == memnode()) != (p == 0U)))
+        continue;
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -135,10 +146,14 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        n_steal_fail = 0U;
         m.release();
         return;
       }
+      busy = busy || wi->stealable();
     }
+    if (!busy)
+      backoff();
   }
 
   /*
@@ -171,6 +186,8 @@ namespace Gecode { namespace Search { namespace Par {
      * when the engine is stopped or has found a solution.
      *
      */
+    // Pin to processing unit, if requested
+    pin();
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
@@ -224,7 +241,12 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              /*
+               * Propagate without holding the mutex: the current space
+               * is not on the path, so thieves can steal meanwhile.
+               */
+              SpaceStatus ss = propagate();
+              switch (ss) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
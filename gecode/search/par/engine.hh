@@ -63,10 +63,37 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Whether the current space is being propagated (without mutex)
+      bool propagating;
+      /// Random number generator for selecting victims
+      Support::RandomGenerator rnd;
+      /// Number of consecutive unsuccessful stealing rounds
+      unsigned int n_steal_fail;
+      /// Processing unit for the worker (if pinned)
+      unsigned int _pu;
+      /// Memory node of the processing unit
+      unsigned int _memnode;
+      /// Back off after an unsuccessful stealing round
+      void backoff(void);
+      /// Propagate current space while not holding the mutex
+      SpaceStatus propagate(void);
+      /// Pin the calling thread to the worker's processing unit (if requested)
+      void pin(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
-      /// Hand over some work (NULL if no work available)
+      /// Place worker as \a i-th worker on processing units and memory nodes
+      void place(unsigned int i);
+      /// Return memory node of the worker
+      unsigned int memnode(void) const;
+      /// Make a quick check whether the worker might have work
+      bool stealable(void) const;
+      /**
+       * \brief Hand over some work (NULL if no work available)
+       *
+       * Never blocks: if the worker is busy manipulating its path,
+       * NULL is returned and the thief should try another worker.
+       */
       Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
       /// Return statistics
       Statistics statistics(void);
@@ -95,7 +95,9 @@ namespace Gecode { namespace Search { namespace Par {
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), propagating(false),
+      rnd(static_cast<unsigned int>(reinterpret_cast<size_t>(this) >> 4)),
+      n_steal_fail(0U), _pu(0U), _memnode(0U) {
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -260,6 +262,36 @@ namespace Gecode { namespace Search { namespace Par {
   /*
    * Worker: finding and stealing working
    */
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::place(unsigned int i) {
+    if (engine().opt().affinity) {
+      _pu = i % Support::Thread::npu();
+      _memnode = Support::Thread::node(_pu);
+    }
+  }
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::memnode(void) const {
+    return _memnode;
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::pin(void) {
+    /*
+     * A pinned worker allocates and caches its heap chunks from its
+     * own thread, which keeps them local to its memory node.
+     */
+    if (engine().opt().affinity)
+      (void) Support::Thread::affinity(_pu);
+  }
+
+  template<class Tracer>
+  forceinline bool
+  Engine<Tracer>::Worker::stealable(void) const {
+    return path.steal();
+  }
+
   template<class Tracer>
   forceinline Space*
   Engine<Tracer>::Worker::steal(unsigned long int& d, 
@@ -272,7 +304,13 @@ namespace Gecode { namespace Search { namespace Par {
      */
     if (!path.steal())
       return NULL;
-    m.acquire();
+    /*
+     * Never wait for the victim: the victim only holds its mutex
+     * while manipulating its path, the thief rather tries another
+     * victim.
+     */
+    if (!m.tryacquire())
+      return NULL;
     Space* s = path.steal(*this,d,myt,ot);
     m.release();
     // Tell that there will be one more busy worker
@@ -281,6 +319,27 @@ namespace Gecode { namespace Search { namespace Par {
     return s;
   }
 
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::backoff(void) {
+    if (n_steal_fail < Config::steal_spin + Config::steal_backoff)
+      n_steal_fail++;
+    if (n_steal_fail > Config::steal_spin)
+      Support::Thread::sleep(n_steal_fail - Config::steal_spin);
+  }
+
+  template<class Tracer>
+  forceinline SpaceStatus
+  Engine<Tracer>::Worker::propagate(void) {
+    // The mutex is held on entry and on exit
+    propagating = true;
+    m.release();
+    SpaceStatus ss = cur->status(*this);
+    m.acquire();
+    propagating = false;
+    return ss;
+  }
+
   /*
    * Return No-Goods
    */
@@ -36,6 +36,8 @@
 
 #include <gecode/search.hh>
 
+#include <atomic>
+
 namespace Gecode { namespace Search { namespace Par {
 
   /// Stop object used for controling slaves in a portfolio
@@ -45,11 +47,21 @@ namespace Gecode { namespace Search { namespace Par {
     Stop* so;
     /// Whether search must be stopped
     volatile bool* tostop;
+    /// Shared incumbent version (NULL if not best solution search)
+    const std::atomic<unsigned long int>* incumbent;
+    /// Incumbent version the slave has been constrained with
+    unsigned long int seen;
   public:
     /// Initialize
     PortfolioStop(Stop* so);
     /// Set pointer to shared \a tostop variable
     void share(volatile bool* ts);
+    /// Set pointer to shared incumbent version \a i
+    void share(const std::atomic<unsigned long int>* i);
+    /// Whether a better solution than the one seen by the slave exists
+    bool stale(void) const;
+    /// Record that the slave has been constrained by the current incumbent
+    void update(void);
     /// Return true if portfolio engine must be stopped
     virtual bool stop(const Statistics& s, const Options& o);
     /// Signal whether search must be stopped
@@ -65,6 +77,7 @@ namespace Gecode { namespace Search { namespace Par {
   /// Runnable slave of a portfolio master
   template<class Collect>
   class GECODE_SEARCH_EXPORT Slave : public Support::Runnable {
+    friend class PBS<Collect>;
   protected:
     /// The master engine
     PBS<Collect>* master;
@@ -105,6 +118,8 @@ namespace Gecode { namespace Search { namespace Par {
     bool empty(void) const;
     /// Return solution reported by \a r
     Space* get(Slave<CollectAll>*& r);
+    /// Dummy function
+    const Space* incumbent(void) const;
     /// Destructor
     ~CollectAll(void);
   };
@@ -129,6 +144,8 @@ namespace Gecode { namespace Search { namespace Par {
     bool empty(void) const;
     /// Return solution reported by \a r (only if a better one was found)
     Space* get(Slave<CollectBest>*& r);
+    /// Return best solution found so far (NULL if none)
+    const Space* incumbent(void) const;
     /// Destructor
     ~CollectBest(void);
   };
@@ -156,14 +173,26 @@ namespace Gecode { namespace Search { namespace Par {
     Support::Mutex m;
     /// Number of busy slaves
     unsigned int n_busy;
-    /// Signal that number of busy slaves becomes zero
+    /// Signal that number of busy slaves becomes zero (or a better solution)
     Support::Event idle;
-    /// Process report from slave, return false if solution was ignored
+    /// Version of the best solution (only for best solution search)
+    std::atomic<unsigned long int> incumbent;
+    /// Process report from slave, return false if slave must continue
     bool report(Slave<Collect>* slave, Space* s);
+    /// Constrain \a slave by the best solution if it has not seen it yet
+    void update(Slave<Collect>* slave);
+    /// Stop all slaves and wait until they are idle
+    void suspend(void);
     /**
      * The key invariant of the engine is as follows:
-     *  - n_busy is always zero outside the next() function.
-     *  - that entails, that locking is only needed insided next().
+     *  - for all solution search, n_busy is always zero outside the
+     *    next() function.
+     *  - for best solution search, slaves keep running after a better
+     *    solution has been returned by next(). Each better solution
+     *    increments incumbent and a slave polls it at each node (through
+     *    its stop object): if the slave has not seen the solution, it is
+     *    stopped, constrained, and resumed. All other operations first
+     *    suspend the slaves.
      *  - the slaves 0..n_active-1 still might not have exausted their
      *    search space.
      *  - the slaves n_active..n_slaves-1 have exhausted their search space.
@@ -57,6 +57,10 @@ namespace Gecode { namespace Search { namespace Par {
   CollectAll::get(Slave<CollectAll>*&) {
     return solutions.pop();
   }
+  forceinline const Space*
+  CollectAll::incumbent(void) const {
+    return NULL;
+  }
   forceinline
   CollectAll::~CollectAll(void) {
     while (!solutions.empty())
@@ -107,6 +111,10 @@ namespace Gecode { namespace Search { namespace Par {
     reporter = NULL;
     return b->clone();
   }
+  forceinline const Space*
+  CollectBest::incumbent(void) const {
+    return b;
+  }
   forceinline
   CollectBest::~CollectBest(void) {
     delete b;
@@ -115,13 +123,29 @@ namespace Gecode { namespace Search { namespace Par {
 
   forceinline
   PortfolioStop::PortfolioStop(Stop* so0)
-    : so(so0), tostop(NULL) {}
+    : so(so0), tostop(NULL), incumbent(NULL), seen(0UL) {}
 
   forceinline void
   PortfolioStop::share(volatile bool* ts) {
     tostop = ts;
   }
 
+  forceinline void
+  PortfolioStop::share(const std::atomic<unsigned long int>* i) {
+    incumbent = i;
+  }
+
+  forceinline bool
+  PortfolioStop::stale(void) const {
+    return (incumbent != NULL) &&
+      (incumbent->load(std::memory_order_acquire) != seen);
+  }
+
+  forceinline void
+  PortfolioStop::update(void) {
+    seen = incumbent->load(std::memory_order_acquire);
+  }
+
 
   template<class Collect>
   forceinline
@@ -156,11 +180,23 @@ namespace Gecode { namespace Search { namespace Par {
                     const Statistics& stat0)
     : stat(stat0), slaves(heap.alloc<Slave<Collect>*>(n)),
       n_slaves(n), n_active(n),
-      slave_stop(false), tostop(false), n_busy(0) {
+      slave_stop(false), tostop(false), n_busy(0), incumbent(0UL) {
     // Initialize slaves
     for (unsigned int i=0U; i<n_slaves; i++) {
       slaves[i] = new Slave<Collect>(this,engines[i],stops[i]);
       static_cast<PortfolioStop*>(stops[i])->share(&tostop);
+      if (Collect::best)
+        static_cast<PortfolioStop*>(stops[i])->share(&incumbent);
+    }
+  }
+
+  template<class Collect>
+  forceinline void
+  PBS<Collect>::update(Slave<Collect>* slave) {
+    PortfolioStop* ps = static_cast<PortfolioStop*>(slave->stop);
+    if (ps->stale()) {
+      ps->update();
+      slave->constrain(*solutions.incumbent());
     }
   }
 
@@ -168,9 +204,29 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Collect>
   forceinline bool
   PBS<Collect>::report(Slave<Collect>* slave, Space* s) {
-    // If b is false the report should be repeated (solution was worse)
+    // If b is false the slave continues (solution was worse)
     bool b = true;
     m.acquire();
+    if (Collect::best && !tostop &&
+        ((s != NULL) || (slave->stopped() &&
+                         static_cast<PortfolioStop*>(slave->stop)
+                           ->stale()))) {
+      /*
+       * Best solution search: the slave continues with the best
+       * solution found so far, a better solution is published to
+       * all other slaves and signalled to the master.
+       */
+      if ((s != NULL) && solutions.add(s,slave)) {
+        incumbent.fetch_add(1UL, std::memory_order_release);
+        // The slave has found the best solution itself
+        static_cast<PortfolioStop*>(slave->stop)->update();
+        idle.signal();
+      } else {
+        update(slave);
+      }
+      m.release();
+      return false;
+    }
     if (s != NULL) {
       b = solutions.add(s,slave);
       if (b)
@@ -205,33 +261,50 @@ namespace Gecode { namespace Search { namespace Par {
     } while (!master->report(this,s));
   }
 
+  template<class Collect>
+  void
+  PBS<Collect>::suspend(void) {
+    m.acquire();
+    tostop = true;
+    while (n_busy > 0) {
+      m.release();
+      idle.wait();
+      m.acquire();
+    }
+    m.release();
+  }
+
   template<class Collect>
   Space*
   PBS<Collect>::next(void) {
     m.acquire();
-    if (solutions.empty()) {
+    if (solutions.empty() && (n_busy == 0)) {
       // Clear all
       tostop = false;
       slave_stop = false;
 
       // Invariant: all slaves are idle!
-      assert(n_busy == 0);
       assert(!tostop);
 
       if (n_active > 0) {
         // Run all active slaves
         n_busy = n_active;
-        for (unsigned int i=0U; i<n_active; i++)
+        for (unsigned int i=0U; i<n_active; i++) {
+          if (Collect::best && (solutions.incumbent() != NULL))
+            update(slaves[i]);
           Support::Thread::run(slaves[i]);
-        m.release();
-        // Wait for all slaves to become idle
-        idle.wait();
-        m.acquire();
+        }
       }
     }
+    // Wait for all slaves to become idle (or a better solution)
+    while ((n_busy > 0) && (!Collect::best || solutions.empty())) {
+      m.release();
+      idle.wait();
+      m.acquire();
+    }
 
-    // Invariant all slaves are idle!
-    assert(n_busy == 0);
+    // Invariant all slaves are idle (unless best solution search)!
+    assert(Collect::best || (n_busy == 0));
 
     Space* s;
 
@@ -241,10 +314,6 @@ namespace Gecode { namespace Search { namespace Par {
     } else {
       Slave<Collect>* r;
       s = solutions.get(r);
-      if (Collect::best)
-        for (unsigned int i=0U; i<n_active; i++)
-          if (slaves[i] != r)
-            slaves[i]->constrain(*s);
     }
 
     m.release();
@@ -260,6 +329,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Collect>
   Statistics
   PBS<Collect>::statistics(void) const {
+    const_cast<PBS<Collect>*>(this)->suspend();
     assert(n_busy == 0);
     Statistics s(stat);
     for (unsigned int i=0U; i<n_slaves; i++)
@@ -270,18 +340,19 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Collect>
   void
   PBS<Collect>::constrain(const Space& b) {
-    assert(n_busy == 0);
     if (!Collect::best)
       throw NoBest("PBS::constrain");
+    suspend();
+    assert(n_busy == 0);
     if (solutions.constrain(b)) {
-      // The solution is better
-      for (unsigned int i=0U; i<n_active; i++)
-        slaves[i]->constrain(b);
+      // The solution is better, slaves pick it up when resumed
+      incumbent.fetch_add(1UL, std::memory_order_release);
     }
   }
 
   template<class Collect>
   PBS<Collect>::~PBS(void) {
+    suspend();
     assert(n_busy == 0);
     heap.free<Slave<Collect>*>(slaves,n_slaves);
   }
@@ -0,0 +1,453 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/proc/engine.hh>
+
+#ifdef GECODE_HAS_PROCESSES
+
+#include <cerrno>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace Gecode { namespace Search { namespace Proc {
+
+  /*
+   * Messages between engine and worker processes
+   *
+   * A message consists of its type, the number of words of its
+   * contents, and the contents.
+   *
+   */
+
+  /// Type of a message
+  enum Message {
+    M_JOB,      ///< Explore subproblem (engine to worker)
+    M_BEST,     ///< Better solution has been found (engine to worker)
+    M_SOLUTION, ///< Solution has been found (worker to engine)
+    M_DONE      ///< Subproblem has been explored (worker to engine)
+  };
+
+  /// Write \a n bytes from \a b to socket \a fd
+  static bool
+  write(int fd, const void* b, size_t n) {
+    const char* c = static_cast<const char*>(b);
+    while (n > 0) {
+      ssize_t m = ::send(fd, c, n, MSG_NOSIGNAL);
+      if (m < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      c += m; n -= static_cast<size_t>(m);
+    }
+    return true;
+  }
+
+  /// Read \a n bytes from socket \a fd into \a b
+  static bool
+  read(int fd, void* b, size_t n) {
+    char* c = static_cast<char*>(b);
+    while (n > 0) {
+      ssize_t m = ::read(fd, c, n);
+      if (m < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      if (m == 0)
+        return false;
+      c += m; n -= static_cast<size_t>(m);
+    }
+    return true;
+  }
+
+  /// Send message \a m with contents \a a to socket \a fd
+  static bool
+  send(int fd, Message m, const Archive& a) {
+    std::vector<unsigned int> b(static_cast<size_t>(a.size()) + 2);
+    b[0] = static_cast<unsigned int>(m);
+    b[1] = static_cast<unsigned int>(a.size());
+    for (int i=0; i<a.size(); i++)
+      b[static_cast<size_t>(i)+2] = a[i];
+    return write(fd, &b[0], b.size()*sizeof(unsigned int));
+  }
+
+  /// Receive message \a m with contents \a a from socket \a fd
+  static bool
+  receive(int fd, Message& m, Archive& a) {
+    unsigned int h[2];
+    if (!read(fd, h, sizeof(h)))
+      return false;
+    m = static_cast<Message>(h[0]);
+    a = Archive();
+    if (h[1] > 0) {
+      std::vector<unsigned int> b(h[1]);
+      if (!read(fd, &b[0], b.size()*sizeof(unsigned int)))
+        return false;
+      for (unsigned int i=0; i<h[1]; i++)
+        a << b[i];
+    }
+    return true;
+  }
+
+  /// Test whether a message is pending on socket \a fd
+  static bool
+  pending(int fd) {
+    struct pollfd p;
+    p.fd = fd; p.events = POLLIN; p.revents = 0;
+    return ::poll(&p, 1, 0) > 0;
+  }
+
+  /// Add statistics \a s to archive \a a
+  static void
+  archive(Archive& a, const Statistics& s) {
+    unsigned long int v[] = {s.node, s.fail, s.depth, s.propagate};
+    for (unsigned long int w : v)
+      a << static_cast<unsigned int>(w & 0xffffffffUL)
+        << static_cast<unsigned int>((w >> 16) >> 16);
+  }
+
+  /// Unarchive statistics from \a a and add them to \a s
+  static void
+  unarchive(Archive& a, Statistics& s) {
+    unsigned long int v[4];
+    for (unsigned long int& w : v) {
+      unsigned long int l = a.get();
+      unsigned long int h = a.get();
+      w = ((h << 16) << 16) | l;
+    }
+    s.node += v[0]; s.fail += v[1]; s.propagate += v[3];
+    if (v[2] > s.depth)
+      s.depth = v[2];
+  }
+
+
+
+  /*
+   * Worker processes
+   *
+   */
+
+  /// Stop object that stops when a message for the worker is pending
+  class Pending : public Stop {
+  protected:
+    /// Socket for communication with the engine
+    int fd;
+    /// Number of calls since last check
+    unsigned int n;
+  public:
+    /// Initialize for socket \a fd0
+    Pending(int fd0) : fd(fd0), n(0U) {}
+    /// Check every few nodes whether a message is pending
+    virtual bool stop(const Statistics&, const Options&) {
+      if (++n < Config::poll)
+        return false;
+      n = 0U;
+      return pending(fd);
+    }
+  };
+
+  /// Return solution archived in \a a recreated from \a root (or NULL)
+  static Space*
+  solution(const Space& root, Archive& a, Statistics& stat) {
+    Space* s = root.clone();
+    s->unarchive(a);
+    if (s->status(stat) != SS_SOLVED) {
+      delete s;
+      return NULL;
+    }
+    (void) s->choice();
+    return s;
+  }
+
+  /// Run worker with socket \a fd for root \a root (does not return)
+  static void
+  work(int fd, const Space& root, const Options& o, bool bab) {
+    Pending p(fd);
+    Options wo(o);
+    wo.clone = false;
+    wo.threads = 1.0;
+    wo.processes = 0;
+    wo.stop = &p;
+    wo.tracer = nullptr;
+    Statistics dummy;
+    Space* best = NULL;
+    Message m;
+    Archive a;
+    while (receive(fd,m,a)) {
+      if (m == M_BEST) {
+        if (Space* b = solution(root,a,dummy)) {
+          delete best; best = b;
+        }
+      } else if (m == M_JOB) {
+        Subproblem sp(a);
+        Space* s = sp.space(root);
+        Search::Engine* e = bab ? babengine(s,wo) : dfsengine(s,wo);
+        if (best != NULL)
+          e->constrain(*best);
+        while (true) {
+          if (Space* t = e->next()) {
+            Archive b;
+            t->archive(b);
+            if (!send(fd,M_SOLUTION,b))
+              _exit(EXIT_FAILURE);
+            if (bab) {
+              delete best; best = t;
+            } else {
+              delete t;
+            }
+          } else if (e->stopped()) {
+            // Messages while exploring can only contain better solutions
+            if (!receive(fd,m,a))
+              _exit(EXIT_SUCCESS);
+            if (Space* b = solution(root,a,dummy)) {
+              e->constrain(*b);
+              delete best; best = b;
+            }
+          } else {
+            break;
+          }
+        }
+        Archive d;
+        archive(d,e->statistics());
+        delete e;
+        if (!send(fd,M_DONE,d))
+          _exit(EXIT_FAILURE);
+      }
+    }
+    _exit(EXIT_SUCCESS);
+  }
+
+
+
+  /*
+   * The engine
+   *
+   */
+
+  Engine::Engine(Space* s, const Options& o, bool b)
+    : opt(o), bab(b), root(NULL), best(NULL), _stopped(false) {
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      stat.fail++;
+      if (!o.clone)
+        delete s;
+      return;
+    }
+    root = snapshot(s,o);
+    unsigned int n = std::max(o.processes,1U);
+    todo.push_back(Subproblem());
+    decompose(*root, todo, n * std::max(o.subproblems,1U), stat, solutions,
+              bab ? &best : NULL);
+    if (todo.empty())
+      return;
+    n = std::min(n,static_cast<unsigned int>(todo.size()));
+    for (unsigned int i=0; i<n; i++) {
+      int sv[2];
+      if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+        terminate();
+        throw OperatingSystemError("Search::Proc::Engine[socketpair]");
+      }
+      pid_t pid = ::fork();
+      if (pid < 0) {
+        ::close(sv[0]); ::close(sv[1]);
+        terminate();
+        throw OperatingSystemError("Search::Proc::Engine[fork]");
+      }
+      if (pid == 0) {
+        // Worker process: never returns to the caller
+        ::close(sv[0]);
+        for (Process& q : ps)
+          ::close(q.fd);
+        try {
+          work(sv[1], *root, opt, bab);
+        } catch (...) {}
+        _exit(EXIT_FAILURE);
+      }
+      ::close(sv[1]);
+      Process q;
+      q.pid = static_cast<int>(pid); q.fd = sv[0]; q.busy = false;
+      ps.push_back(q);
+    }
+    if (best != NULL)
+      broadcast(*best,NULL);
+  }
+
+  bool
+  Engine::receive(Process& p) {
+    Message m;
+    Archive a;
+    if (!Proc::receive(p.fd,m,a))
+      return false;
+    switch (m) {
+    case M_SOLUTION:
+      {
+        Space* s = solution(*root,a,stat);
+        if (s == NULL)
+          return false;
+        if (bab) {
+          if (best != NULL) {
+            // Check whether the solution is still better
+            Space* c = s->clone();
+            c->constrain(*best);
+            bool better = (c->status() != SS_FAILED);
+            delete c;
+            if (!better) {
+              delete s;
+              return true;
+            }
+            delete best;
+          }
+          best = s->clone();
+          broadcast(*best,&p);
+        }
+        solutions.push_back(s);
+      }
+      return true;
+    case M_DONE:
+      unarchive(a,stat);
+      p.busy = false;
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  void
+  Engine::broadcast(const Space& b, const Process* p) {
+    Archive a;
+    b.archive(a);
+    for (Process& q : ps)
+      if (&q != p)
+        (void) send(q.fd,M_BEST,a);
+  }
+
+  Space*
+  Engine::next(void) {
+    _stopped = false;
+    while (true) {
+      if (!solutions.empty()) {
+        Space* s = solutions.front();
+        solutions.pop_front();
+        return s;
+      }
+      bool busy = false;
+      for (Process& p : ps) {
+        if (!p.busy && !todo.empty()) {
+          if (!send(p.fd,M_JOB,todo.front().path()))
+            throw OperatingSystemError("Search::Proc::Engine::next");
+          todo.pop_front();
+          p.busy = true;
+        }
+        busy |= p.busy;
+      }
+      if (!busy)
+        return NULL;
+      if ((opt.stop != NULL) && opt.stop->stop(stat,opt)) {
+        _stopped = true;
+        return NULL;
+      }
+      std::vector<struct pollfd> fds(ps.size());
+      for (size_t i=0; i<ps.size(); i++) {
+        fds[i].fd = ps[i].fd; fds[i].events = POLLIN; fds[i].revents = 0;
+      }
+      // Wake up regularly to check the stop object
+      int r = ::poll(&fds[0], static_cast<nfds_t>(fds.size()),
+                     (opt.stop != NULL) ? Config::proc_timeout : -1);
+      if (r < 0) {
+        if (errno == EINTR)
+          continue;
+        throw OperatingSystemError("Search::Proc::Engine::next");
+      }
+      for (size_t i=0; i<ps.size(); i++)
+        if ((fds[i].revents != 0) && !receive(ps[i]))
+          throw OperatingSystemError("Search::Proc::Engine::next");
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Engine::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  Engine::stopped(void) const {
+    return _stopped;
+  }
+
+  void
+  Engine::constrain(const Space& b) {
+    if (!bab)
+      throw NoBest("Proc::Engine::constrain");
+    if (best != NULL) {
+      best->constrain(b);
+      if (best->status() != SS_FAILED)
+        return;
+      delete best;
+    }
+    best = b.clone();
+    broadcast(b,NULL);
+  }
+
+  void
+  Engine::terminate(void) {
+    // Closing the sockets terminates the workers
+    for (Process& p : ps)
+      ::close(p.fd);
+    for (Process& p : ps) {
+      int status;
+      while ((::waitpid(static_cast<pid_t>(p.pid), &status, 0) < 0) &&
+             (errno == EINTR))
+        ;
+    }
+    ps.clear();
+  }
+
+  Engine::~Engine(void) {
+    terminate();
+    delete root;
+    delete best;
+    while (!solutions.empty()) {
+      delete solutions.front();
+      solutions.pop_front();
+    }
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-proc
@@ -0,0 +1,110 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PROC_ENGINE_HH__
+#define __GECODE_SEARCH_PROC_ENGINE_HH__
+
+#include <deque>
+#include <vector>
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/subproblem.hh>
+
+namespace Gecode { namespace Search { namespace Proc {
+
+  /**
+   * \brief %Search engine using worker processes
+   *
+   * The engine decomposes the search tree breadth-first into
+   * subproblems (see Subproblem) and hands them out to worker
+   * processes one at a time. Each worker process explores its
+   * subproblem with a sequential engine and sends the solutions it
+   * finds back to the engine, where they are recreated from the root
+   * space (see Space::archive and Space::unarchive). For best solution
+   * search, each better solution is forwarded to all workers.
+   *
+   * Workers are created by forking the current process and communicate
+   * with the engine through local sockets. Hence, the engine must not
+   * be created while other threads are running.
+   */
+  class Engine : public Search::Engine {
+  protected:
+    /// Information about a worker process
+    class Process {
+    public:
+      /// Process identifier
+      int pid;
+      /// Socket for communication with the worker
+      int fd;
+      /// Whether the worker is exploring a subproblem
+      bool busy;
+    };
+    /// Search options
+    Options opt;
+    /// Whether best solution search is performed
+    bool bab;
+    /// The root space (NULL if failed)
+    Space* root;
+    /// The best solution so far (for best solution search)
+    Space* best;
+    /// Subproblems to be explored
+    std::deque<Subproblem> todo;
+    /// Solutions not yet returned
+    std::deque<Space*> solutions;
+    /// The worker processes
+    std::vector<Process> ps;
+    /// Statistics of the engine and of all finished subproblems
+    Statistics stat;
+    /// Whether engine has been stopped
+    bool _stopped;
+    /// Handle message from worker \a p, return false if \a p is gone
+    bool receive(Process& p);
+    /// Send best solution \a b to all workers except \a p
+    void broadcast(const Space& b, const Process* p);
+    /// Terminate all worker processes
+    void terminate(void);
+  public:
+    /// Initialize for space \a s with options \a o (best solution search if \a b)
+    Engine(Space* s, const Options& o, bool b);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor: terminates all worker processes
+    virtual ~Engine(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-proc
@@ -76,6 +76,10 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a a
+    void checkpoint(Archive& a) const;
+    /// Restore search state from checkpoint \a a
+    void restore(Archive& a);
     /// Destructor
     ~BAB(void);
   };
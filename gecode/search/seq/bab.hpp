@@ -40,7 +40,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
+    : tracer(o.tracer), opt(o),
+      path(o.checkpoint ? UINT_MAX : opt.nogoods_limit), d(0), mark(0),
       best(NULL) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
@@ -198,6 +199,68 @@ namespace Gecode { namespace Search { namespace Seq {
     return path;
   }
 
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::checkpoint(Archive& a) const {
+    if (!opt.checkpoint)
+      throw NoCheckpoint("BAB::checkpoint");
+    checkpointHeader(a,CE_BAB);
+    a << (cur != NULL) << (best != NULL);
+    if (best != NULL)
+      best->archive(a);
+    path.checkpoint(a);
+  }
+
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::restore(Archive& a) {
+    if (!opt.checkpoint)
+      throw NoCheckpoint("BAB::restore");
+    if (!path.empty() || (best != NULL))
+      throw InvalidCheckpoint("BAB::restore");
+    restoreHeader(a,CE_BAB);
+    bool c, b; a >> c >> b;
+    Space* s = NULL;
+    if (b) {
+      if (cur == NULL)
+        throw InvalidCheckpoint("BAB::restore");
+      // Recreate best solution from the root space
+      s = cur->clone();
+      try {
+        s->unarchive(a);
+      } catch (...) {
+        delete s;
+        throw;
+      }
+      if (s->status(*this) != SS_SOLVED) {
+        delete s;
+        throw InvalidCheckpoint("BAB::restore");
+      }
+      // Deletes all pending branchers
+      (void) s->choice();
+    }
+    try {
+      if (path.restore(a,cur)) {
+        // The path points to the next space
+        cur = NULL;
+        d = 0;
+      } else if (!c) {
+        // Search has already been finished
+        delete cur;
+        cur = NULL;
+      }
+    } catch (...) {
+      delete s;
+      throw;
+    }
+    if (s != NULL) {
+      best = s;
+      if (cur != NULL)
+        cur->constrain(*best);
+      mark = path.entries();
+    }
+  }
+
   template<class Tracer>
   forceinline
   BAB<Tracer>::~BAB(void) {
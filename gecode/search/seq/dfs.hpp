@@ -36,7 +36,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0) {
+    : tracer(o.tracer), opt(o),
+      path(o.checkpoint ? UINT_MAX : opt.nogoods_limit), d(0) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::DFS, 1U);
       tracer.worker();
@@ -172,6 +173,36 @@ namespace Gecode { namespace Search { namespace Seq {
     assert(false);
   }
 
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::checkpoint(Archive& a) const {
+    if (!opt.checkpoint)
+      throw NoCheckpoint("DFS::checkpoint");
+    checkpointHeader(a,CE_DFS);
+    a << (cur != NULL);
+    path.checkpoint(a);
+  }
+
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::restore(Archive& a) {
+    if (!opt.checkpoint)
+      throw NoCheckpoint("DFS::restore");
+    if (!path.empty())
+      throw InvalidCheckpoint("DFS::restore");
+    restoreHeader(a,CE_DFS);
+    bool c; a >> c;
+    if (path.restore(a,cur)) {
+      // The path points to the next space
+      cur = NULL;
+      d = 0;
+    } else if (!c) {
+      // Search has already been finished
+      delete cur;
+      cur = NULL;
+    }
+  }
+
   template<class Tracer>
   forceinline
   DFS<Tracer>::~DFS(void) {
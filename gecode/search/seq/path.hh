@@ -78,6 +78,8 @@ namespace Gecode { namespace Search { namespace Seq {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge with clone \a c (possibly NULL) for choice \a ch at alternative \a a
+      Edge(Space* c, const Choice* ch, unsigned int a);
 
       /// Return space for edge
       Space* space(void) const;
@@ -145,6 +147,17 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(void);
     /// Post no-goods
     virtual void post(Space& home) const;
+    /// Write choices and alternatives of all edges to checkpoint \a a
+    void checkpoint(Archive& a) const;
+    /**
+     * \brief Restore path from checkpoint \a a for root space \a s
+     *
+     * The path must be empty and the root space \a s must be stable.
+     * The edges are restored without clones except for the first edge
+     * which takes \a s as its clone. Returns whether the checkpoint
+     * contained a non-empty path, otherwise \a s is not used.
+     */
+    bool restore(Archive& a, Space* s);
   };
 
 }}}
@@ -46,6 +46,11 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::Edge::Edge(Space* s, Space* c, unsigned int nid)
     : _space(c), _alt(0), _choice(s->choice()), _nid(nid) {}
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(Space* c, const Choice* ch, unsigned int a)
+    : _space(c), _alt(a), _choice(ch), _nid(0) {}
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -386,6 +391,53 @@ namespace Gecode { namespace Search { namespace Seq {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::checkpoint(Archive& a) const {
+    a << static_cast<unsigned int>(ds.entries());
+    for (int i=0; i<ds.entries(); i++) {
+      // Edges reused by LAO would lose their choice
+      assert(!ds[i].lao());
+      Archive c;
+      ds[i].choice()->archive(c);
+      a << ds[i].alt() << static_cast<unsigned int>(c.size());
+      for (int j=0; j<c.size(); j++)
+        a << c[j];
+    }
+  }
+
+  template<class Tracer>
+  bool
+  Path<Tracer>::restore(Archive& a, Space* s) {
+    assert(ds.empty());
+    unsigned int n; a >> n;
+    if ((n > 0) && (s == NULL))
+      throw InvalidCheckpoint("Path::restore");
+    for (unsigned int i=0; i<n; i++) {
+      unsigned int alt, m; a >> alt >> m;
+      Archive c;
+      for (unsigned int j=0; j<m; j++) {
+        unsigned int w; a >> w; c << w;
+      }
+      const Choice* ch;
+      try {
+        ch = s->choice(c);
+      } catch (SpaceNoBrancher&) {
+        throw InvalidCheckpoint("Path::restore");
+      }
+      if (alt >= ch->alternatives()) {
+        delete ch;
+        throw InvalidCheckpoint("Path::restore");
+      }
+      Edge e(NULL,ch,alt);
+      ds.push(e);
+    }
+    if (n == 0)
+      return false;
+    ds[0].space(s);
+    return true;
+  }
+
 }}}
 
 // STATISTICS: search-seq
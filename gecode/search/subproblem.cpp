@@ -0,0 +1,102 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/subproblem.hh>
+
+namespace Gecode { namespace Search {
+
+  Space*
+  Subproblem::space(const Space& root) const {
+    Space* s = root.clone();
+    int i = 0;
+    while (i < p.size()) {
+      unsigned int alt = p[i++];
+      int k = static_cast<int>(p[i++]);
+      Archive c;
+      for (int j=0; j<k; j++)
+        c << p[i++];
+      const Choice* ch = root.choice(c);
+      s->commit(*ch,alt);
+      delete ch;
+    }
+    return s;
+  }
+
+  void
+  decompose(const Space& root, std::deque<Subproblem>& q, unsigned int n,
+            Statistics& stat, std::deque<Space*>& s, Space** best) {
+    unsigned long int d = 0;
+    while (!q.empty() && (q.size() < n)) {
+      std::deque<Subproblem> c;
+      d++;
+      while (!q.empty()) {
+        if (c.size() + q.size() >= n) {
+          // Enough subproblems, keep the remaining ones unexpanded
+          c.insert(c.end(),q.begin(),q.end());
+          q.clear();
+          break;
+        }
+        Subproblem sp = q.front(); q.pop_front();
+        Space* t = sp.space(root);
+        if ((best != NULL) && (*best != NULL))
+          t->constrain(**best);
+        stat.node++;
+        switch (t->status(stat)) {
+        case SS_FAILED:
+          stat.fail++;
+          delete t;
+          break;
+        case SS_SOLVED:
+          (void) t->choice();
+          if (best != NULL) {
+            delete *best;
+            *best = t->clone();
+          }
+          s.push_back(t);
+          break;
+        case SS_BRANCH:
+          {
+            const Choice* ch = t->choice();
+            for (unsigned int a=0; a<ch->alternatives(); a++)
+              c.push_back(sp.child(*ch,a));
+            delete ch;
+            delete t;
+          }
+          break;
+        default:
+          GECODE_NEVER;
+        }
+      }
+      q.swap(c);
+      if (d > stat.depth)
+        stat.depth = d;
+    }
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -0,0 +1,110 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_SUBPROBLEM_HH__
+#define __GECODE_SEARCH_SUBPROBLEM_HH__
+
+#include <deque>
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Subproblem defined by a path of choices from the root
+   *
+   * For each edge on the path from the root, the subproblem stores the
+   * alternative, the size of the archived choice, and the archived
+   * choice. As archived choices only refer to branchers by their
+   * identity, a subproblem can be recomputed from any space that has
+   * been created by the same model, for example in a different process.
+   */
+  class Subproblem {
+  protected:
+    /// The archived path
+    Archive p;
+  public:
+    /// Initialize as the root problem
+    Subproblem(void);
+    /// Initialize from archived path \a a
+    Subproblem(const Archive& a);
+    /// Return archived path
+    const Archive& path(void) const;
+    /// Return subproblem for alternative \a alt of choice \a c
+    Subproblem child(const Choice& c, unsigned int alt) const;
+    /**
+     * \brief Return space for subproblem recomputed from \a root
+     *
+     * The space \a root must be stable and not failed. The returned
+     * space has not yet been propagated.
+     */
+    GECODE_SEARCH_EXPORT Space* space(const Space& root) const;
+  };
+
+  /**
+   * \brief Decompose subproblems in \a q breadth-first
+   *
+   * Subproblems in \a q are replaced by their children, one level at
+   * a time, until \a q contains at least \a n subproblems or is empty.
+   * The order of \a q is maintained to be the order in which
+   * depth-first search would explore the subproblems. Failed
+   * subproblems are dropped, solutions are appended to \a s.
+   *
+   * If \a best is not NULL, best solution search is performed: each
+   * subproblem is constrained by the solution \a best points to (if
+   * any) and \a best is updated by a clone of each solution found.
+   */
+  GECODE_SEARCH_EXPORT void
+  decompose(const Space& root, std::deque<Subproblem>& q, unsigned int n,
+            Statistics& stat, std::deque<Space*>& s, Space** best);
+
+
+
+  forceinline
+  Subproblem::Subproblem(void) {}
+  forceinline
+  Subproblem::Subproblem(const Archive& a) : p(a) {}
+  forceinline const Archive&
+  Subproblem::path(void) const {
+    return p;
+  }
+  forceinline Subproblem
+  Subproblem::child(const Choice& c, unsigned int alt) const {
+    Archive a;
+    c.archive(a);
+    Subproblem s(*this);
+    s.p << alt << static_cast<unsigned int>(a.size());
+    for (int i=0; i<a.size(); i++)
+      s.p << a[i];
+    return s;
+  }
+
+}}
+
+#endif
+
+// STATISTICS: search-other
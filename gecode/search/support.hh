@@ -63,8 +63,25 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a a
+    virtual void checkpoint(Archive& a) const;
+    /// Restore search state from checkpoint \a a
+    virtual void restore(Archive& a);
   };
 
+  /// Kind of engine that has written a checkpoint
+  enum CheckpointEngine {
+    CE_DFS = 0, ///< Depth-first search
+    CE_BAB = 1  ///< Branch-and-bound search
+  };
+
+  /// Write header of checkpoint for engine \a ce to \a a
+  forceinline void
+  checkpointHeader(Archive& a, CheckpointEngine ce);
+  /// Read header of checkpoint from \a a and check that it matches \a ce
+  forceinline void
+  restoreHeader(Archive& a, CheckpointEngine ce);
+
 
 
   forceinline Space*
@@ -72,6 +89,24 @@ namespace Gecode { namespace Search {
     return o.clone ? s->clone() : s;
   }
 
+  /// Magic number at the start of a checkpoint
+  const unsigned int checkpoint_magic = 0x47434b50U;
+
+  forceinline void
+  checkpointHeader(Archive& a, CheckpointEngine ce) {
+    a << checkpoint_magic << Config::checkpoint_version
+      << static_cast<unsigned int>(ce);
+  }
+
+  forceinline void
+  restoreHeader(Archive& a, CheckpointEngine ce) {
+    unsigned int m, v, e;
+    a >> m >> v >> e;
+    if ((m != checkpoint_magic) || (v != Config::checkpoint_version) ||
+        (e != static_cast<unsigned int>(ce)))
+      throw InvalidCheckpoint("Search::restore");
+  }
+
 
   template<class Worker>
   WorkerToEngine<Worker>::WorkerToEngine(Space* s, const Options& o)
@@ -106,6 +141,16 @@ namespace Gecode { namespace Search {
   WorkerToEngine<Worker>::nogoods(void) {
     return w.nogoods();
   }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::checkpoint(Archive& a) const {
+    w.checkpoint(a);
+  }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::restore(Archive& a) {
+    w.restore(a);
+  }
 
 }}
 
@@ -83,6 +83,8 @@ namespace Gecode { namespace Search {
     /// The engine creates a new node with information \a ei and \a ni
     void node(const SearchTracer::EdgeInfo& ei,
               const SearchTracer::NodeInfo& ni);
+    /// The worker explores subproblem \a sid in epoch \a e
+    void schedule(unsigned int e, unsigned int sid);
     /// The worker is done
     void done(void);
     /// Whether this is a real tracer
@@ -210,6 +212,11 @@ namespace Gecode { namespace Search {
     tracer._node(ei,ni);
   }
 
+  forceinline void
+  TraceRecorder::schedule(unsigned int e, unsigned int sid) {
+    tracer._schedule(_wid,e,sid);
+  }
+
   forceinline void
   TraceRecorder::done(void) {
     tracer.worker();
@@ -109,6 +109,14 @@ namespace Gecode {
     }
   }
   
+  void
+  StdSearchTracer::schedule(unsigned int wid, unsigned int e,
+                            unsigned int sid) {
+    os << "trace<Search>::schedule(w:" << wid
+       << ",epoch:" << e
+       << ",s:" << sid << ")" << std::endl;
+  }
+
   void
   StdSearchTracer::done(void) {
     os << "trace<Search>::done()" << std::endl;
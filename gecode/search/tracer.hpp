@@ -219,6 +219,17 @@ namespace Gecode {
     m.release();
   }
 
+  forceinline void
+  SearchTracer::_schedule(unsigned int wid, unsigned int e,
+                          unsigned int sid) {
+    m.acquire();
+    schedule(wid,e,sid);
+    m.release();
+  }
+
+  forceinline void
+  SearchTracer::schedule(unsigned int, unsigned int, unsigned int) {}
+
   forceinline
   SearchTracer::SearchTracer(void) 
     : pending(1U), n_e(0U), n_w(0U), es(heap), w2e(heap) {}
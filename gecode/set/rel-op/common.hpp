@@ -85,6 +85,207 @@ namespace Set { namespace RelOp {
     return shared(v0,v1) || shared(v0,v2) || shared(v1,v2);
   }
 
+  /*
+   * Propagation steps for binary operations
+   *
+   * Each step is performed with range iterators. If all views are set
+   * views with both bounds represented as bitsets, the step is
+   * performed word by word instead.
+   *
+   */
+
+  /// Include \f$\mathit{glb}(x_0)\cap\mathit{glb}(x_1)\f$ in \a y
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  includeInter(Space& home, View0& x0, View1& x1, View2& y) {
+    GlbRanges<View0> x0lb(x0);
+    GlbRanges<View1> x1lb(x1);
+    Iter::Ranges::Inter<GlbRanges<View0>, GlbRanges<View1> > i(x0lb,x1lb);
+    return y.includeI(home,i);
+  }
+  /// Include \f$\mathit{glb}(x_0)\cap\mathit{glb}(x_1)\f$ in \a y
+  forceinline ModEvent
+  includeInter(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return includeInter<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Inter<BndSetWords,BndSetWords> i(x0.glbWords(),x1.glbWords());
+    return y.includeW(home,i);
+  }
+
+  /// Include \f$\mathit{glb}(x_0)\cup\mathit{glb}(x_1)\f$ in \a y
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  includeUnion(Space& home, View0& x0, View1& x1, View2& y) {
+    GlbRanges<View0> x0lb(x0);
+    GlbRanges<View1> x1lb(x1);
+    Iter::Ranges::Union<GlbRanges<View0>, GlbRanges<View1> > u(x0lb,x1lb);
+    return y.includeI(home,u);
+  }
+  /// Include \f$\mathit{glb}(x_0)\cup\mathit{glb}(x_1)\f$ in \a y
+  forceinline ModEvent
+  includeUnion(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return includeUnion<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Union<BndSetWords,BndSetWords> u(x0.glbWords(),x1.glbWords());
+    return y.includeW(home,u);
+  }
+
+  /// Include \f$\mathit{glb}(x_0)\setminus\mathit{lub}(x_1)\f$ in \a y
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  includeDiff(Space& home, View0& x0, View1& x1, View2& y) {
+    GlbRanges<View0> x0lb(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Diff<GlbRanges<View0>, LubRanges<View1> > d(x0lb,x1ub);
+    return y.includeI(home,d);
+  }
+  /// Include \f$\mathit{glb}(x_0)\setminus\mathit{lub}(x_1)\f$ in \a y
+  forceinline ModEvent
+  includeDiff(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return includeDiff<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Diff<BndSetWords,BndSetWords> d(x0.glbWords(),x1.lubWords());
+    return y.includeW(home,d);
+  }
+
+  /// Include \f$\mathit{glb}(x)\f$ in \a y
+  template<class View0, class View1>
+  forceinline ModEvent
+  includeGlb(Space& home, View0& x, View1& y) {
+    GlbRanges<View0> xlb(x);
+    return y.includeI(home,xlb);
+  }
+  /// Include \f$\mathit{glb}(x)\f$ in \a y
+  forceinline ModEvent
+  includeGlb(Space& home, SetView& x, SetView& y) {
+    if (!x.words() || !y.words())
+      return includeGlb<SetView,SetView>(home,x,y);
+    return y.includeW(home,x.glbWords());
+  }
+
+  /// Exclude \f$\mathit{glb}(x_0)\setminus\mathit{lub}(x_1)\f$ from \a y
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  excludeDiff(Space& home, View0& x0, View1& x1, View2& y) {
+    GlbRanges<View0> x0lb(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Diff<GlbRanges<View0>, LubRanges<View1> > d(x0lb,x1ub);
+    return y.excludeI(home,d);
+  }
+  /// Exclude \f$\mathit{glb}(x_0)\setminus\mathit{lub}(x_1)\f$ from \a y
+  forceinline ModEvent
+  excludeDiff(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return excludeDiff<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Diff<BndSetWords,BndSetWords> d(x0.glbWords(),x1.lubWords());
+    return y.excludeW(home,d);
+  }
+
+  /// Intersect \a y with \f$\mathit{lub}(x_0)\cap\mathit{lub}(x_1)\f$
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  intersectInter(Space& home, View0& x0, View1& x1, View2& y) {
+    LubRanges<View0> x0ub(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Inter<LubRanges<View0>, LubRanges<View1> > i(x0ub,x1ub);
+    return y.intersectI(home,i);
+  }
+  /// Intersect \a y with \f$\mathit{lub}(x_0)\cap\mathit{lub}(x_1)\f$
+  forceinline ModEvent
+  intersectInter(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return intersectInter<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Inter<BndSetWords,BndSetWords> i(x0.lubWords(),x1.lubWords());
+    return y.intersectW(home,i);
+  }
+
+  /// Intersect \a y with \f$\mathit{lub}(x_0)\cup\mathit{lub}(x_1)\f$
+  template<class View0, class View1, class View2>
+  forceinline ModEvent
+  intersectUnion(Space& home, View0& x0, View1& x1, View2& y) {
+    LubRanges<View0> x0ub(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Union<LubRanges<View0>, LubRanges<View1> > u(x0ub,x1ub);
+    return y.intersectI(home,u);
+  }
+  /// Intersect \a y with \f$\mathit{lub}(x_0)\cup\mathit{lub}(x_1)\f$
+  forceinline ModEvent
+  intersectUnion(Space& home, SetView& x0, SetView& x1, SetView& y) {
+    if (!x0.words() || !x1.words() || !y.words())
+      return intersectUnion<SetView,SetView,SetView>(home,x0,x1,y);
+    Words::Union<BndSetWords,BndSetWords> u(x0.lubWords(),x1.lubWords());
+    return y.intersectW(home,u);
+  }
+
+  /// Intersect \a y with \f$\mathit{lub}(x)\f$
+  template<class View0, class View1>
+  forceinline ModEvent
+  intersectLub(Space& home, View0& x, View1& y) {
+    LubRanges<View0> xub(x);
+    return y.intersectI(home,xub);
+  }
+  /// Intersect \a y with \f$\mathit{lub}(x)\f$
+  forceinline ModEvent
+  intersectLub(Space& home, SetView& x, SetView& y) {
+    if (!x.words() || !y.words())
+      return intersectLub<SetView,SetView>(home,x,y);
+    return y.intersectW(home,x.lubWords());
+  }
+
+  /// Return size of \f$\mathit{glb}(x_0)\cup\mathit{glb}(x_1)\f$
+  template<class View0, class View1>
+  forceinline unsigned int
+  glbUnionSize(View0& x0, View1& x1) {
+    GlbRanges<View0> x0lb(x0);
+    GlbRanges<View1> x1lb(x1);
+    Iter::Ranges::Union<GlbRanges<View0>, GlbRanges<View1> > u(x0lb,x1lb);
+    return Iter::Ranges::size(u);
+  }
+  /// Return size of \f$\mathit{glb}(x_0)\cup\mathit{glb}(x_1)\f$
+  forceinline unsigned int
+  glbUnionSize(SetView& x0, SetView& x1) {
+    if (!x0.words() || !x1.words())
+      return glbUnionSize<SetView,SetView>(x0,x1);
+    Words::Union<BndSetWords,BndSetWords> u(x0.glbWords(),x1.glbWords());
+    return Words::size(u);
+  }
+
+  /// Return size of \f$\mathit{lub}(x_0)\cup\mathit{lub}(x_1)\f$
+  template<class View0, class View1>
+  forceinline unsigned int
+  lubUnionSize(View0& x0, View1& x1) {
+    LubRanges<View0> x0ub(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Union<LubRanges<View0>, LubRanges<View1> > u(x0ub,x1ub);
+    return Iter::Ranges::size(u);
+  }
+  /// Return size of \f$\mathit{lub}(x_0)\cup\mathit{lub}(x_1)\f$
+  forceinline unsigned int
+  lubUnionSize(SetView& x0, SetView& x1) {
+    if (!x0.words() || !x1.words())
+      return lubUnionSize<SetView,SetView>(x0,x1);
+    Words::Union<BndSetWords,BndSetWords> u(x0.lubWords(),x1.lubWords());
+    return Words::size(u);
+  }
+
+  /// Return size of \f$\mathit{lub}(x_0)\cap\mathit{lub}(x_1)\f$
+  template<class View0, class View1>
+  forceinline unsigned int
+  lubInterSize(View0& x0, View1& x1) {
+    LubRanges<View0> x0ub(x0);
+    LubRanges<View1> x1ub(x1);
+    Iter::Ranges::Inter<LubRanges<View0>, LubRanges<View1> > i(x0ub,x1ub);
+    return Iter::Ranges::size(i);
+  }
+  /// Return size of \f$\mathit{lub}(x_0)\cap\mathit{lub}(x_1)\f$
+  forceinline unsigned int
+  lubInterSize(SetView& x0, SetView& x1) {
+    if (!x0.words() || !x1.words())
+      return lubInterSize<SetView,SetView>(x0,x1);
+    Words::Inter<BndSetWords,BndSetWords> i(x0.lubWords(),x1.lubWords());
+    return Words::size(i);
+  }
+
   template<class View0, class View1, class View2>
   ExecStatus interCard(Space& home,
                        bool& retmodified, View0& x0, View1& x1, View2& x2) {
@@ -94,11 +295,7 @@ namespace Set { namespace RelOp {
       modified = false;
 
       {
-        LubRanges<View0> x0ub(x0);
-        LubRanges<View1> x1ub(x1);
-        Iter::Ranges::Union<LubRanges<View0>, LubRanges<View1> >
-          u1(x0ub,x1ub);
-        unsigned int s1 = Iter::Ranges::size(u1);
+        unsigned int s1 = lubUnionSize(x0,x1);
 
         if (x0.cardMin() + x1.cardMin() > s1) {
           GECODE_ME_CHECK_MODIFIED(modified,
@@ -114,11 +311,7 @@ namespace Set { namespace RelOp {
       }
 
       {
-        GlbRanges<View0> x0lb(x0);
-        GlbRanges<View1> x1lb(x1);
-        Iter::Ranges::Union<GlbRanges<View0>, GlbRanges<View1> >
-          u1(x0lb,x1lb);
-        unsigned int s1 = Iter::Ranges::size(u1);
+        unsigned int s1 = glbUnionSize(x0,x1);
         GECODE_ME_CHECK_MODIFIED(modified,
                           x2.cardMax(home,
                                      x0.cardMax()+x1.cardMax()-s1));
@@ -150,10 +343,7 @@ namespace Set { namespace RelOp {
       modified = false;
 
       {
-        LubRanges<View0> x0ub(x0);
-        LubRanges<View1> x1ub(x1);
-        Iter::Ranges::Inter<LubRanges<View0>, LubRanges<View1> > i1(x0ub,x1ub);
-        unsigned int s1 = Iter::Ranges::size(i1);
+        unsigned int s1 = lubInterSize(x0,x1);
         unsigned int res = std::max(x0.cardMin()+
                                     (x1.cardMin()<s1 ?
                                      0 : x1.cardMin()-s1),
@@ -163,10 +353,7 @@ namespace Set { namespace RelOp {
       }
 
       {
-        LubRanges<View0> x0ub(x0);
-        LubRanges<View1> x1ub(x1);
-        Iter::Ranges::Union<LubRanges<View0>, LubRanges<View1> > u1(x0ub,x1ub);
-        unsigned int s1 = Iter::Ranges::size(u1);
+        unsigned int s1 = lubUnionSize(x0,x1);
         GECODE_ME_CHECK_MODIFIED(modified,
                           x2.cardMax(home,
                                      std::min(x0.cardMax()+x1.cardMax(),s1)));
@@ -80,26 +80,19 @@ namespace Gecode { namespace Set { namespace RelOp {
       modified = false;
       do {
         // 4) glb(x2) <= glb(x0) \cap glb(x1)
-        {
-          GlbRanges<View0> x0lb(x0);
-          GlbRanges<View1> x1lb(x1);
-          Iter::Ranges::Inter<GlbRanges<View0>, GlbRanges<View1> >
-            i2(x0lb,x1lb);
-          GECODE_ME_CHECK_MODIFIED(modified, x2.includeI(home,i2) );
-        }
+        GECODE_ME_CHECK_MODIFIED(modified,
+                                 includeInter(home,x0,x1,x2) );
 
         if (modified || Rel::testSetEventLB(me2) )
           {
             modified = false;
             // 5) x2 <= x0
-            GlbRanges<View2> x2lb1(x2);
-            GECODE_ME_CHECK_MODIFIED(modified, x0.includeI(home,x2lb1) );
+            GECODE_ME_CHECK_MODIFIED(modified, includeGlb(home,x2,x0) );
             x0lbmod |= modified;
 
             // 6) x2 <= x1
             bool modified2=false;
-            GlbRanges<View2> x2lb2(x2);
-            GECODE_ME_CHECK_MODIFIED(modified2, x1.includeI(home,x2lb2) );
+            GECODE_ME_CHECK_MODIFIED(modified2, includeGlb(home,x2,x1) );
             x1lbmod |= modified2;
             modified |= modified2;
           }
@@ -115,33 +108,24 @@ namespace Gecode { namespace Set { namespace RelOp {
              || x0lbmod || modifiedOld)
           {
             // 1) lub(x2) \ glb(x0) => lub(x1)
-            GlbRanges<View0> x0lb(x0);
-            LubRanges<View2> x2ub(x2);
-            Iter::Ranges::Diff<GlbRanges<View0>,LubRanges<View2> >
-              diff(x0lb, x2ub);
-            GECODE_ME_CHECK_MODIFIED(modified, x1.excludeI(home,diff) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     excludeDiff(home,x0,x2,x1) );
           }
 
         if (Rel::testSetEventUB(me2) || Rel::testSetEventLB(me1)
             || x1lbmod || modifiedOld)
           {
             // 2) lub(x2) \ glb(x1) => lub(x0)
-            GlbRanges<View1> x1lb(x1);
-            LubRanges<View2> x2ub(x2);
-            Iter::Ranges::Diff<GlbRanges<View1>, LubRanges<View2> >
-              diff(x1lb, x2ub);
-            GECODE_ME_CHECK_MODIFIED(modified, x0.excludeI(home,diff) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     excludeDiff(home,x1,x2,x0) );
           }
 
          if (Rel::testSetEventUB(me0,me1) || modified)
           {
             //            modified = false;
             // 3) lub(x0) \cap lub(x1) <= lub(x2)
-            LubRanges<View0> x0ub(x0);
-            LubRanges<View1> x1ub(x1);
-            Iter::Ranges::Inter<LubRanges<View0>, LubRanges<View1> >
-              i1(x0ub,x1ub);
-            GECODE_ME_CHECK_MODIFIED(modified, x2.intersectI(home,i1) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     intersectInter(home,x0,x1,x2) );
           }
 
       } while(modified);
@@ -93,25 +93,19 @@ namespace Gecode { namespace Set { namespace RelOp {
       modified = false;
       do {
         // 4) lub(x2) <= lub(x0) u lub(x1)
-        {
-          LubRanges<View0> x0ub(x0);
-          LubRanges<View1> x1ub(x1);
-          Iter::Ranges::Union<LubRanges<View0>, LubRanges<View1> > u2(x0ub,x1ub);
-          GECODE_ME_CHECK_MODIFIED(modified, x2.intersectI(home,u2) );
-        }
+        GECODE_ME_CHECK_MODIFIED(modified,
+                                 intersectUnion(home,x0,x1,x2) );
 
         if (modified || Rel::testSetEventUB(me2) )
           {
             modified = false;
             // 5) x0 <= x2
-            LubRanges<View2> x2ub1(x2);
-            GECODE_ME_CHECK_MODIFIED(modified, x0.intersectI(home,x2ub1) );
+            GECODE_ME_CHECK_MODIFIED(modified, intersectLub(home,x2,x0) );
             x0ubmod |= modified;
 
             // 6) x1 <= x2
             bool modified2=false;
-            LubRanges<View2> x2ub2(x2);
-            GECODE_ME_CHECK_MODIFIED(modified2, x1.intersectI(home,x2ub2) );
+            GECODE_ME_CHECK_MODIFIED(modified2, intersectLub(home,x2,x1) );
             x1ubmod |= modified2;
             modified |= modified2;
           }
@@ -127,33 +121,24 @@ namespace Gecode { namespace Set { namespace RelOp {
              || x0ubmod || modifiedOld)
           {
             // 1) glb(x0) \ lub(x1) <= glb(x2)
-            GlbRanges<View2> x2lb(x2);
-            LubRanges<View0> x0ub(x0);
-            Iter::Ranges::Diff<GlbRanges<View2>, LubRanges<View0> >
-              diff(x2lb, x0ub);
-            GECODE_ME_CHECK_MODIFIED(modified, x1.includeI(home,diff) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     includeDiff(home,x2,x0,x1) );
           }
 
         if (Rel::testSetEventLB(me2) || Rel::testSetEventUB(me1)
             || x1ubmod || modifiedOld)
           {
             // 2) glb(x0) \ lub(x2) <= glb(x1)
-            GlbRanges<View2> x2lb(x2);
-            LubRanges<View1> x1ub(x1);
-            Iter::Ranges::Diff<GlbRanges<View2>, LubRanges<View1> >
-              diff(x2lb, x1ub);
-            GECODE_ME_CHECK_MODIFIED(modified, x0.includeI(home,diff) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     includeDiff(home,x2,x1,x0) );
           }
 
          if (Rel::testSetEventLB(me0,me1) || modified)
           {
             //            modified = false;
             // 3) glb(x1) u glb(x2) <= glb(x0)
-            GlbRanges<View0> x0lb(x0);
-            GlbRanges<View1> x1lb(x1);
-            Iter::Ranges::Union<GlbRanges<View0>, GlbRanges<View1> >
-              u1(x0lb,x1lb);
-            GECODE_ME_CHECK_MODIFIED(modified, x2.includeI(home,u1) );
+            GECODE_ME_CHECK_MODIFIED(modified,
+                                     includeUnion(home,x0,x1,x2) );
           }
 
       } while(modified);
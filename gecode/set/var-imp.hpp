@@ -87,9 +87,68 @@ namespace Gecode { namespace Set {
    * \brief Sets of integers
    */
   class BndSet  {
+  public:
+    /**
+     * \brief Bitsets for sets
+     *
+     * Bit \a i of the bitset corresponds to the value \a base + \a i,
+     * where \a base is a multiple of the bits per data element. Hence,
+     * data elements of different bitsets correspond to each other.
+     * The bits for values smaller than \a min or larger than \a max
+     * are not set.
+     */
+    class BitBnd {
+    public:
+      /// Value corresponding to the first bit
+      int base;
+      /// Number of data elements
+      unsigned int n;
+      /// Smallest element (if not empty)
+      int min;
+      /// Largest element (if not empty)
+      int max;
+      /// The bits (actually \a n data elements)
+      Support::BitSetData data[1];
+      /// \name Memory management
+      //@{
+      /// Allocate without elements for values from \a l to \a h
+      static BitBnd* allocate(Space& home, int l, int h);
+      /// Return copy for values from \a l to \a h
+      BitBnd* copy(Space& home, int l, int h) const;
+      /// Free memory
+      void dispose(Space& home);
+      //@}
+      /// \name Access and update
+      //@{
+      /// Test whether values from \a l to \a h can be represented
+      bool covers(int l, int h) const;
+      /// Test whether value \a v is included
+      bool get(int v) const;
+      /// Include values from \a l to \a h and return number of new values
+      unsigned int set(int l, int h);
+      /// Exclude values from \a l to \a h and return number of excluded values
+      unsigned int clear(int l, int h);
+      /// Return smallest included value from \a v to \a m (\a m+1 if none)
+      int next(int v, int m) const;
+      /// Return smallest excluded value from \a v to \a m (\a m+1 if none)
+      int skip(int v, int m) const;
+      /// Return largest included value from \a m to \a v (\a m-1 if none)
+      int prev(int v, int m) const;
+      /// Return largest excluded value from \a m to \a v (\a m-1 if none)
+      int skip_prev(int v, int m) const;
+      /// Return number of included values from \a l to \a h
+      unsigned int ones(int l, int h) const;
+      //@}
+    };
   private:
+    /// First range (NULL if empty or represented as bitset)
     RangeList* first;
-    RangeList* last;
+    union {
+      /// Last range (set represented as range list)
+      RangeList* last;
+      /// Bits (set represented as bitset)
+      BitBnd* _bits;
+    };
   protected:
     /// The size of this set
     unsigned int _size;
@@ -104,6 +163,10 @@ namespace Gecode { namespace Set {
     RangeList* fst(void) const;
     /// Return last range
     RangeList* lst(void) const;
+    /// Set bits to \a b
+    void bits(BitBnd* b);
+    /// Update minimum and maximum of bits after values have been excluded
+    void bits_pruned(void);
 
   public:
     /// Returned by empty sets when asked for their maximum element
@@ -149,6 +212,28 @@ namespace Gecode { namespace Set {
     bool empty(void) const;
     /// Test whether \a i is an element of this set
     bool in(int i) const;
+    /// Test whether all of \f$\{i,\dots,j\}\f$ are elements of this set
+    bool subset(int i, int j) const;
+    /// Test whether none of \f$\{i,\dots,j\}\f$ is an element of this set
+    bool disjoint(int i, int j) const;
+    /// Test whether this set is a subset of \a s
+    bool subset(const BndSet& s) const;
+    //@}
+
+    /// \name Representation
+    //@{
+    /// Test whether set is represented as bitset
+    bool bitset(void) const;
+    /// Return bits (only if represented as bitset)
+    BitBnd* bits(void) const;
+    /**
+     * \brief Represent set as bitset for values from \a l to \a h
+     *
+     * All elements of the set must be between \a l and \a h.
+     */
+    GECODE_SET_EXPORT void bitset(Space& home, int l, int h);
+    /// Represent set as range list
+    GECODE_SET_EXPORT void rangelist(Space& home);
     //@}
 
     /// \name Update operations
@@ -159,7 +244,7 @@ namespace Gecode { namespace Set {
 
     /// \name Range list access for iteration
     //@{
-    /// Return range list for iteration
+    /// Return range list for iteration (only if represented as range list)
     RangeList* ranges(void) const;
     //@}
 
@@ -172,6 +257,13 @@ namespace Gecode { namespace Set {
     //@{
     /// Update this set to be a clone of set \a x
     void update(Space& home, BndSet& x);
+    /**
+     * \brief Update this set to be a clone of set \a x
+     *
+     * If \a x is represented as bitset, the clone can represent all
+     * values from \a l to \a h.
+     */
+    void update(Space& home, BndSet& x, int l, int h);
     //@}
 
     /// Check whether internal invariants hold
@@ -182,7 +274,24 @@ namespace Gecode { namespace Set {
    * \brief Range iterator for integer sets
    *
    */
-  class BndSetRanges : public Iter::Ranges::RangeList {
+  class BndSetRanges {
+  private:
+    /// Current range (set represented as range list)
+    const RangeList* c;
+    /// Bits (NULL if set is represented as range list)
+    const BndSet::BitBnd* b;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
+    /// Index of current data element (set represented as bitset)
+    unsigned int i;
+    /// Index of last data element (set represented as bitset)
+    unsigned int l;
+    /// Bits of current data element not yet iterated
+    Support::BitSetData w;
+    /// Find next range in bits
+    void find(void);
   public:
     /// \name Constructors and initialization
     //@{
@@ -193,6 +302,61 @@ namespace Gecode { namespace Set {
     /// Initialize with BndSet \a s
     void init(const BndSet& s);
     //@}
+
+    /// \name Iteration control
+    //@{
+    /// Test whether iterator is still at a range or done
+    bool operator ()(void) const;
+    /// Move iterator to next range (if possible)
+    void operator ++(void);
+    //@}
+
+    /// \name Range access
+    //@{
+    /// Return smallest value of range
+    int min(void) const;
+    /// Return largest value of range
+    int max(void) const;
+    /// Return width of range (distance between minimum and maximum)
+    unsigned int width(void) const;
+    //@}
+  };
+
+  /**
+   * \brief Word source for integer sets represented as bitsets
+   *
+   * \see Words
+   */
+  class BndSetWords {
+  private:
+    /// The data elements
+    const Support::BitSetData* d;
+    /// Index of the first data element of the bitset
+    int o;
+    /// Index of first data element
+    int f;
+    /// Index of last data element
+    int l;
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Default constructor
+    BndSetWords(void);
+    /// Initialize with BndSet \a s (must be represented as bitset)
+    BndSetWords(const BndSet& s);
+    /// Initialize with BndSet \a s (must be represented as bitset)
+    void init(const BndSet& s);
+    //@}
+
+    /// \name Data element access
+    //@{
+    /// Return index of first data element
+    int fst(void) const;
+    /// Return index of last data element
+    int lst(void) const;
+    /// Return data element \a k
+    Support::BitSetData operator [](int k) const;
+    //@}
   };
 
   /**
@@ -227,6 +391,13 @@ namespace Gecode { namespace Set {
     bool include(Space& home,int i,int j,SetDelta& d);
     /// Include the set represented by \a i in this set
     template<class I> bool includeI(Space& home,I& i);
+    /**
+     * \brief Include the set represented by word source \a w in this set
+     *
+     * The set must be represented as bitset that can represent all
+     * values of \a w.
+     */
+    template<class W> bool includeW(const W& w);
     //@}
   private:
     GLBndSet(const GLBndSet&);
@@ -271,6 +442,10 @@ namespace Gecode { namespace Set {
     template<class I> bool excludeI(Space& home, I& i);
     /// Exclude all elements from this set
     void excludeAll(Space& home);
+    /// Exclude all elements not in word source \a w (set must be a bitset)
+    template<class W> bool intersectW(const W& w);
+    /// Exclude all elements in word source \a w (set must be a bitset)
+    template<class W> bool excludeW(const W& w);
     //@}
   private:
     LUBndSet(const LUBndSet&);
@@ -417,6 +592,7 @@ namespace Gecode { namespace Set {
 
 }}
 
+#include <gecode/set/var-imp/words.hpp>
 #include <gecode/set/var-imp/integerset.hpp>
 #include <gecode/set/var-imp/iter.hpp>
 
@@ -436,6 +612,17 @@ namespace Gecode { namespace Set {
     /// The greatest lower bound of the domain
     GLBndSet glb;
 
+    /**
+     * \brief Maximal width of the least upper bound for bitsets
+     *
+     * If the least upper bound of a newly created variable is not
+     * wider, both bounds are represented as bitsets rather than as
+     * range lists.
+     */
+    static const unsigned int bits_max = 4096U;
+    /// Represent both bounds as bitsets if the least upper bound is small
+    GECODE_SET_EXPORT void bitsets(Space& home);
+
   protected:
     /// Constructor for cloning \a x
     SetVarImp(Space& home, SetVarImp& x);
@@ -573,6 +760,22 @@ namespace Gecode { namespace Set {
     template<class I> ModEvent intersectI(Space& home,I& i);
     //@}
 
+    /// \name Word-parallel access and update
+    //@{
+    /// Test whether both bounds are represented as bitsets
+    bool words(void) const;
+    /// Return word source for greatest lower bound (only if words())
+    BndSetWords glbWords(void) const;
+    /// Return word source for least upper bound (only if words())
+    BndSetWords lubWords(void) const;
+    /// Include set described by word source \a w in the greatest lower bound
+    template<class W> ModEvent includeW(Space& home,const W& w);
+    /// Exclude set described by word source \a w from the least upper bound
+    template<class W> ModEvent excludeW(Space& home,const W& w);
+    /// Exclude everything but word source \a w from the least upper bound
+    template<class W> ModEvent intersectW(Space& home,const W& w);
+    //@}
+
   public:
     /// \name Dependencies
     //@{
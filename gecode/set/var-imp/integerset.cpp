@@ -56,6 +56,46 @@ namespace Gecode { namespace Set {
     assert(isConsistent());
   }
 
+  void
+  BndSet::bitset(Space& home, int l, int h) {
+    assert(!bitset() && (l <= h));
+    BitBnd* b = BitBnd::allocate(home,l,h);
+    for (RangeList* c = fst(); c != NULL; c = c->next()) {
+      assert((c->min() >= l) && (c->max() <= h));
+      b->set(c->min(),c->max());
+    }
+    if (fst() != NULL) {
+      b->min = min(); b->max = max();
+      fst()->dispose(home,lst());
+    }
+    bits(b);
+    assert(isConsistent());
+  }
+
+  void
+  BndSet::rangelist(Space& home) {
+    assert(bitset());
+    BitBnd* b = bits();
+    RangeList* f = NULL;
+    RangeList* l = NULL;
+    if (_size > 0) {
+      int mi = b->min;
+      while (mi <= b->max) {
+        int ma = b->skip(mi,b->max)-1;
+        RangeList* r = new (home) RangeList(mi,ma,NULL);
+        if (l == NULL)
+          f = r;
+        else
+          l->next(r);
+        l = r;
+        mi = b->next(ma+1,b->max);
+      }
+    }
+    b->dispose(home);
+    fst(f); lst(l);
+    assert(isConsistent());
+  }
+
   bool
   GLBndSet::include_full(Space& home, int mi, int ma, SetDelta& d) {
     assert(ma >= mi);
@@ -288,6 +328,22 @@ namespace Gecode { namespace Set {
   bool
   BndSet::isConsistent(void) const {
 #ifndef NDEBUG
+    if (bitset()) {
+      const BitBnd* b = bits();
+      if (size() == 0) {
+        if ((b->min != MIN_OF_EMPTY) || (b->max != MAX_OF_EMPTY)) {
+          std::cerr << "Strange empty bitset.\n";
+          return false;
+        }
+        return true;
+      }
+      if (!b->covers(b->min,b->max) || !b->get(b->min) || !b->get(b->max) ||
+          (b->ones(b->min,b->max) != size())) {
+        std::cerr << "Inconsistent bitset.\n";
+        return false;
+      }
+      return true;
+    }
     if (fst()==NULL) {
       if (lst()!=NULL || size()!=0) {
         std::cerr<<"Strange empty set.\n";
@@ -37,6 +37,198 @@
 
 namespace Gecode { namespace Set {
 
+  /*
+   * Bitsets for sets
+   *
+   */
+
+  forceinline BndSet::BitBnd*
+  BndSet::BitBnd::allocate(Space& home, int l, int h) {
+    // Align the first bit such that bits of different sets match
+    const int bpb = static_cast<int>(Support::BitSetData::bpb);
+    int r = l % bpb;
+    if (r < 0)
+      r += bpb;
+    l -= r;
+    unsigned int n = Support::BitSetData::data
+      (static_cast<unsigned int>(h-l)+1U);
+    BitBnd* b = static_cast<BitBnd*>
+      (home.ralloc(sizeof(BitBnd) + (n-1)*sizeof(Support::BitSetData)));
+    b->base = l; b->n = n;
+    b->min = MIN_OF_EMPTY; b->max = MAX_OF_EMPTY;
+    for (unsigned int i=0; i<n; i++)
+      b->data[i].init(false);
+    return b;
+  }
+
+  forceinline BndSet::BitBnd*
+  BndSet::BitBnd::copy(Space& home, int l, int h) const {
+    assert(covers(l,h));
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int f = static_cast<unsigned int>(l-base) / bpb;
+    unsigned int t = static_cast<unsigned int>(h-base) / bpb;
+    BitBnd* b = static_cast<BitBnd*>
+      (home.ralloc(sizeof(BitBnd) + (t-f)*sizeof(Support::BitSetData)));
+    b->base = base + static_cast<int>(f*bpb); b->n = t-f+1;
+    b->min = min; b->max = max;
+    for (unsigned int i=0; i<b->n; i++)
+      b->data[i] = data[f+i];
+    return b;
+  }
+
+  forceinline void
+  BndSet::BitBnd::dispose(Space& home) {
+    home.rfree(this, sizeof(BitBnd) + (n-1)*sizeof(Support::BitSetData));
+  }
+
+  forceinline bool
+  BndSet::BitBnd::covers(int l, int h) const {
+    return (l >= base) &&
+      (static_cast<unsigned int>(h-base) < n*Support::BitSetData::bpb);
+  }
+
+  forceinline bool
+  BndSet::BitBnd::get(int v) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    return data[p / bpb].get(p % bpb);
+  }
+
+  forceinline unsigned int
+  BndSet::BitBnd::set(int l, int h) {
+    assert((l <= h) && covers(l,h));
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    unsigned int s;
+    if (i == j) {
+      s = data[i].ones(p % bpb, q % bpb);
+      data[i].set(p % bpb, q % bpb);
+    } else {
+      s = data[i].ones(p % bpb, bpb-1U);
+      data[i].set(p % bpb, bpb-1U);
+      for (unsigned int k=i+1; k<j; k++) {
+        s += data[k].ones();
+        data[k].init(true);
+      }
+      s += data[j].ones(0U, q % bpb);
+      data[j].set(0U, q % bpb);
+    }
+    return q-p+1U-s;
+  }
+
+  forceinline unsigned int
+  BndSet::BitBnd::clear(int l, int h) {
+    assert((l <= h) && covers(l,h));
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    unsigned int s;
+    if (i == j) {
+      s = data[i].ones(p % bpb, q % bpb);
+      data[i].clear(p % bpb, q % bpb);
+    } else {
+      s = data[i].ones(p % bpb, bpb-1U);
+      data[i].clear(p % bpb, bpb-1U);
+      for (unsigned int k=i+1; k<j; k++) {
+        s += data[k].ones();
+        data[k].init(false);
+      }
+      s += data[j].ones(0U, q % bpb);
+      data[j].clear(0U, q % bpb);
+    }
+    return s;
+  }
+
+  forceinline int
+  BndSet::BitBnd::next(int v, int m) const {
+    if (v > m)
+      return m+1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int l = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!data[i].any(o,bpb-1U)) {
+      if (++i > l / bpb)
+        return m+1;
+      o = 0U;
+    }
+    p = i*bpb + data[i].next(o);
+    return (p <= l) ? base + static_cast<int>(p) : m+1;
+  }
+
+  forceinline int
+  BndSet::BitBnd::skip(int v, int m) const {
+    if (v > m)
+      return m+1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int l = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!(~data[i]).any(o,bpb-1U)) {
+      if (++i > l / bpb)
+        return m+1;
+      o = 0U;
+    }
+    p = i*bpb + (~data[i]).next(o);
+    return (p <= l) ? base + static_cast<int>(p) : m+1;
+  }
+
+  forceinline int
+  BndSet::BitBnd::prev(int v, int m) const {
+    if (v < m)
+      return m-1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int f = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!data[i].any(0U,o)) {
+      if (i-- == f / bpb)
+        return m-1;
+      o = bpb-1U;
+    }
+    p = i*bpb + data[i].prev(o);
+    return (p >= f) ? base + static_cast<int>(p) : m-1;
+  }
+
+  forceinline int
+  BndSet::BitBnd::skip_prev(int v, int m) const {
+    if (v < m)
+      return m-1;
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(v-base);
+    unsigned int f = static_cast<unsigned int>(m-base);
+    unsigned int i = p / bpb;
+    unsigned int o = p % bpb;
+    while (!(~data[i]).any(0U,o)) {
+      if (i-- == f / bpb)
+        return m-1;
+      o = bpb-1U;
+    }
+    p = i*bpb + (~data[i]).prev(o);
+    return (p >= f) ? base + static_cast<int>(p) : m-1;
+  }
+
+  forceinline unsigned int
+  BndSet::BitBnd::ones(int l, int h) const {
+    assert(l <= h);
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int p = static_cast<unsigned int>(l-base);
+    unsigned int q = static_cast<unsigned int>(h-base);
+    unsigned int i = p / bpb, j = q / bpb;
+    if (i == j)
+      return data[i].ones(p % bpb, q % bpb);
+    unsigned int s = data[i].ones(p % bpb, bpb-1U);
+    for (unsigned int k=i+1; k<j; k++)
+      s += data[k].ones();
+    return s + data[j].ones(0U, q % bpb);
+  }
+
   /*
    * BndSet
    *
@@ -56,10 +248,39 @@ namespace Gecode { namespace Set {
     return last;
   }
 
+  forceinline bool
+  BndSet::bitset(void) const {
+    return (first == NULL) && (_bits != NULL);
+  }
+
+  forceinline BndSet::BitBnd*
+  BndSet::bits(void) const {
+    assert(bitset());
+    return _bits;
+  }
+
+  forceinline void
+  BndSet::bits(BitBnd* b) {
+    first = NULL; _bits = b;
+  }
+
+  forceinline void
+  BndSet::bits_pruned(void) {
+    BitBnd* b = bits();
+    if (_size == 0) {
+      b->min = MIN_OF_EMPTY; b->max = MAX_OF_EMPTY;
+    } else {
+      b->min = b->next(b->min,b->max);
+      b->max = b->prev(b->max,b->min);
+    }
+  }
+
   forceinline void
   BndSet::dispose(Space& home) {
     if (fst()!=NULL)
       fst()->dispose(home,lst());
+    else if (bitset())
+      bits()->dispose(home);
   }
 
   forceinline void
@@ -86,6 +307,7 @@ namespace Gecode { namespace Set {
 
   forceinline RangeList*
   BndSet::ranges(void) const {
+    assert(!bitset());
     return fst();
   }
 
@@ -101,23 +323,41 @@ namespace Gecode { namespace Set {
 
   forceinline int
   BndSet::min(void) const {
-    if (fst()==NULL)
-      return MIN_OF_EMPTY;
-    else
+    if (fst()!=NULL)
       return fst()->min();
+    else if (bitset())
+      return bits()->min;
+    else
+      return MIN_OF_EMPTY;
   }
 
   forceinline int
   BndSet::max(void) const {
-    if (lst()==NULL)
-      return MAX_OF_EMPTY;
-    else
+    if (fst()!=NULL)
       return lst()->max();
+    else if (bitset())
+      return bits()->max;
+    else
+      return MAX_OF_EMPTY;
   }
 
   // nth smallest element
   forceinline int
   BndSet::minN(unsigned int n) const {
+    if (bitset()) {
+      if (n >= _size)
+        return MIN_OF_EMPTY;
+      const BitBnd* b = bits();
+      int l = b->min;
+      while (true) {
+        int h = b->skip(l,b->max) - 1;
+        unsigned int w = static_cast<unsigned int>(h-l) + 1U;
+        if (w > n)
+          return l + static_cast<int>(n);
+        n -= w;
+        l = b->next(h+1,b->max);
+      }
+    }
     for (RangeList* c = fst(); c != NULL; c = c->next()) {
       if (c->width() > n)
         return static_cast<int>(c->min() + n);
@@ -138,10 +378,19 @@ namespace Gecode { namespace Set {
 
   forceinline void
   BndSet::update(Space& home, BndSet& d) {
+    if (d.bitset()) {
+      dispose(home);
+      _size = d.size();
+      const BitBnd* b = d.bits();
+      if (d.empty())
+        bits(b->copy(home,b->base,b->base));
+      else
+        bits(b->copy(home,b->min,b->max));
+      return;
+    }
     if (d.fst() == fst())
       return;
-    if (fst() != NULL)
-      fst()->dispose(home,lst());
+    dispose(home);
     _size = d.size();
     if (_size == 0) {
       fst(NULL); lst(NULL);
@@ -167,8 +416,20 @@ namespace Gecode { namespace Set {
     r[n-1].next(NULL);
   }
 
+  forceinline void
+  BndSet::update(Space& home, BndSet& d, int l, int h) {
+    if (d.bitset()) {
+      dispose(home);
+      _size = d.size();
+      bits(d.bits()->copy(home,l,h));
+    } else {
+      update(home,d);
+    }
+  }
+
   template<class I> forceinline bool
   BndSet::overwrite(Space& home, I& ri) {
+    assert(!bitset());
     // Is new domain empty?
     if (!ri()) {
       //Was it empty?
@@ -213,15 +474,19 @@ namespace Gecode { namespace Set {
       assert(lst()!=NULL);
       assert(fst()!= that.fst());
       fst()->dispose(home,lst());
+    } else if (bitset() && (_bits != that._bits)) {
+      bits()->dispose(home);
     }
-    fst(that.fst());
-    lst(that.lst());
+    first = that.first;
+    last = that.last;
     _size = that.size();
     assert(isConsistent());
   }
 
   forceinline bool
   BndSet::in(int i) const {
+    if (bitset())
+      return (i >= min()) && (i <= max()) && bits()->get(i);
     for (RangeList* c = fst(); c != NULL; c = c->next()) {
       if (c->min() <= i && c->max() >= i)
         return true;
@@ -231,6 +496,59 @@ namespace Gecode { namespace Set {
     return false;
   }
 
+  forceinline bool
+  BndSet::subset(int i, int j) const {
+    assert(i <= j);
+    if ((i < min()) || (j > max()))
+      return false;
+    if (bitset())
+      return bits()->skip(i,j) > j;
+    for (RangeList* c = fst(); c != NULL; c = c->next())
+      if (c->max() >= i)
+        return (c->min() <= i) && (c->max() >= j);
+    GECODE_NEVER;
+    return false;
+  }
+
+  forceinline bool
+  BndSet::disjoint(int i, int j) const {
+    assert(i <= j);
+    if ((j < min()) || (i > max()))
+      return true;
+    if (bitset()) {
+      int m = std::min(j,max());
+      return bits()->next(std::max(i,min()),m) > m;
+    }
+    for (RangeList* c = fst(); c != NULL; c = c->next())
+      if (c->max() >= i)
+        return c->min() > j;
+    return true;
+  }
+
+  forceinline bool
+  BndSet::subset(const BndSet& s) const {
+    if (empty())
+      return true;
+    if ((min() < s.min()) || (max() > s.max()))
+      return false;
+    if (bitset() && s.bitset()) {
+      // Compare word by word, both bitsets have the same alignment
+      const unsigned int bpb = Support::BitSetData::bpb;
+      const BitBnd* x = bits();
+      const BitBnd* y = s.bits();
+      assert((x->base - y->base) % static_cast<int>(bpb) == 0);
+      unsigned int f = static_cast<unsigned int>(x->min-x->base) / bpb;
+      unsigned int l = static_cast<unsigned int>(x->max-x->base) / bpb;
+      unsigned int o = static_cast<unsigned int>(x->base-y->base) / bpb;
+      for (unsigned int i=f; i<=l; i++)
+        if (!Support::BitSetData::a(x->data[i],~y->data[o+i]).none())
+          return false;
+      return true;
+    }
+    BndSetRanges xr(*this), yr(s);
+    return Iter::Ranges::subset(xr,yr);
+  }
+
   /*
    * Range iterator for BndSets
    *
@@ -239,13 +557,138 @@ namespace Gecode { namespace Set {
   forceinline
   BndSetRanges::BndSetRanges(void) {}
 
-  forceinline
-  BndSetRanges::BndSetRanges(const BndSet& s)
-    : Iter::Ranges::RangeList(s.ranges()) {}
+  forceinline void
+  BndSetRanges::find(void) {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    while (w.none()) {
+      if (++i > l) {
+        mi = 1; ma = 0;
+        return;
+      }
+      w = b->data[i];
+    }
+    unsigned int f = w.next(0U);
+    mi = b->base + static_cast<int>(i*bpb + f);
+    // Find first excluded value after f, possibly in a later element
+    Support::BitSetData z = ~w;
+    z.clear(0U,f);
+    while (z.none()) {
+      if (++i > l) {
+        // Bits beyond the maximum are never set
+        ma = b->max; w.init(false);
+        return;
+      }
+      w = b->data[i]; z = ~w;
+    }
+    unsigned int t = z.next(0U);
+    ma = b->base + static_cast<int>(i*bpb + t) - 1;
+    if (t > 0U)
+      w.clear(0U,t-1U);
+  }
 
   forceinline void
   BndSetRanges::init(const BndSet& s) {
-    Iter::Ranges::RangeList::init(s.ranges());
+    i = l = 0U; w.init(false);
+    if (s.bitset()) {
+      c = NULL; b = s.bits();
+      if (s.empty()) {
+        mi = 1; ma = 0;
+      } else {
+        const unsigned int bpb = Support::BitSetData::bpb;
+        i = static_cast<unsigned int>(b->min-b->base) / bpb;
+        l = static_cast<unsigned int>(b->max-b->base) / bpb;
+        w = b->data[i];
+        find();
+      }
+    } else {
+      c = s.ranges(); b = NULL;
+      if (c != NULL) {
+        mi = c->min(); ma = c->max();
+      } else {
+        mi = 1; ma = 0;
+      }
+    }
+  }
+
+  forceinline
+  BndSetRanges::BndSetRanges(const BndSet& s) {
+    init(s);
+  }
+
+  forceinline bool
+  BndSetRanges::operator ()(void) const {
+    return mi <= ma;
+  }
+
+  forceinline void
+  BndSetRanges::operator ++(void) {
+    if (b == NULL) {
+      c = c->next();
+      if (c != NULL) {
+        mi = c->min(); ma = c->max();
+      } else {
+        mi = 1; ma = 0;
+      }
+    } else {
+      find();
+    }
+  }
+
+  forceinline int
+  BndSetRanges::min(void) const {
+    return mi;
+  }
+
+  forceinline int
+  BndSetRanges::max(void) const {
+    return ma;
+  }
+
+  forceinline unsigned int
+  BndSetRanges::width(void) const {
+    return static_cast<unsigned int>(ma-mi)+1;
+  }
+
+  /*
+   * Word source for BndSets
+   *
+   */
+
+  forceinline
+  BndSetWords::BndSetWords(void) {}
+
+  forceinline void
+  BndSetWords::init(const BndSet& s) {
+    const int bpb = static_cast<int>(Support::BitSetData::bpb);
+    const BndSet::BitBnd* b = s.bits();
+    d = &b->data[0]; o = b->base / bpb;
+    if (s.empty()) {
+      f = 0; l = -1;
+    } else {
+      f = o + (b->min - b->base) / bpb;
+      l = o + (b->max - b->base) / bpb;
+    }
+  }
+
+  forceinline
+  BndSetWords::BndSetWords(const BndSet& s) {
+    init(s);
+  }
+
+  forceinline int
+  BndSetWords::fst(void) const {
+    return f;
+  }
+
+  forceinline int
+  BndSetWords::lst(void) const {
+    return l;
+  }
+
+  forceinline Support::BitSetData
+  BndSetWords::operator [](int k) const {
+    assert((k >= f) && (k <= l));
+    return d[k-o];
   }
 
   /*
@@ -278,6 +721,22 @@ namespace Gecode { namespace Set {
   forceinline bool
   GLBndSet::include(Space& home, int mi, int ma, SetDelta& d) {
     assert(ma >= mi);
+    if (bitset()) {
+      BitBnd* b = bits();
+      if (b->covers(mi,ma)) {
+        int l = b->skip(mi,ma);
+        if (l > ma)
+          return false;
+        int h = b->skip_prev(ma,l);
+        _size += b->set(l,h);
+        b->min = std::min(b->min,l);
+        b->max = std::max(b->max,h);
+        d._glbMin = l;
+        d._glbMax = h;
+        return true;
+      }
+      rangelist(home);
+    }
     if (fst()==NULL) {
       RangeList* p = new (home) RangeList(mi,ma,NULL);
       fst(p);
@@ -296,6 +755,27 @@ namespace Gecode { namespace Set {
   GLBndSet::includeI(Space& home, I& i) {
     if (!i())
       return false;
+    if (bitset()) {
+      BitBnd* b = bits();
+      unsigned int s = 0;
+      for (; i(); ++i) {
+        if (!b->covers(i.min(),i.max()))
+          break;
+        s += b->set(i.min(),i.max());
+        b->min = std::min(b->min,i.min());
+        b->max = std::max(b->max,i.max());
+      }
+      _size += s;
+      if (!i())
+        return s > 0;
+      // Remaining values cannot be represented by the bitset
+      rangelist(home);
+      BndSetRanges j(*this);
+      Iter::Ranges::Union<BndSetRanges,I> ij(j,i);
+      bool me = overwrite(home, ij);
+      assert(isConsistent());
+      return me || (s > 0);
+    }
     BndSetRanges j(*this);
     Iter::Ranges::Union<BndSetRanges,I> ij(j,i);
     bool me = overwrite(home, ij);
@@ -303,6 +783,35 @@ namespace Gecode { namespace Set {
     return me;
   }
 
+  template<class W> bool
+  GLBndSet::includeW(const W& w) {
+    const int bpb = static_cast<int>(Support::BitSetData::bpb);
+    BitBnd* b = bits();
+    int o = b->base / bpb;
+    int mi = min(), ma = max();
+    unsigned int s = 0;
+    for (int k=w.fst(), l=w.lst(); k<=l; k++) {
+      Support::BitSetData wk = w[k];
+      if (wk.none())
+        continue;
+      assert((k >= o) && (k-o < static_cast<int>(b->n)));
+      Support::BitSetData& dk = b->data[k-o];
+      Support::BitSetData n = Support::BitSetData::a(wk,~dk);
+      if (n.none())
+        continue;
+      s += n.ones();
+      dk.o(n);
+      mi = std::min(mi,k*bpb+static_cast<int>(n.next(0U)));
+      ma = std::max(ma,k*bpb+static_cast<int>(n.prev(bpb-1)));
+    }
+    if (s == 0)
+      return false;
+    _size += s;
+    b->min = mi; b->max = ma;
+    assert(isConsistent());
+    return true;
+  }
+
 
   /*
    * LUBndSet
@@ -339,6 +848,19 @@ namespace Gecode { namespace Set {
   LUBndSet::exclude(Space& home, int mi, int ma, SetDelta& d) {
     assert(ma >= mi);
     if ((mi > max()) || (ma < min())) { return false; }
+    if (bitset()) {
+      BitBnd* b = bits();
+      int m = std::min(ma,b->max);
+      int l = b->next(std::max(mi,b->min),m);
+      if (l > m)
+        return false;
+      int h = b->prev(m,l);
+      _size -= b->clear(l,h);
+      d._lubMin = l;
+      d._lubMax = h;
+      bits_pruned();
+      return true;
+    }
     if (mi <= min() && ma >= max() ) { //the range covers the whole set
       d._lubMin = min();
       d._lubMax = max();
@@ -356,6 +878,15 @@ namespace Gecode { namespace Set {
     assert(ma >= mi);
     if ((mi <= min()) && (ma >= max())) { return false; }
     if (_size == 0) return false;
+    if (bitset()) {
+      BitBnd* b = bits();
+      if (mi > b->min)
+        _size -= b->clear(b->min,std::min(mi-1,b->max));
+      if (ma < b->max)
+        _size -= b->clear(std::max(ma+1,b->min),b->max);
+      bits_pruned();
+      return true;
+    }
     if (ma < min() || mi > max() ) { // empty the whole set
      fst()->dispose(home,lst()); fst(NULL); lst(NULL);
      _size=0;
@@ -368,6 +899,32 @@ namespace Gecode { namespace Set {
 
   template<class I> bool
   LUBndSet::intersectI(Space& home, I& i) {
+    if (bitset()) {
+      if (empty())
+        return false;
+      BitBnd* b = bits();
+      unsigned int s = 0;
+      // Values from l on are not yet known to be in the iterator
+      int l = b->min;
+      while (i() && (l <= b->max)) {
+        if (i.max() >= l) {
+          if (i.min() > l)
+            s += b->clear(l,std::min(i.min()-1,b->max));
+          if (i.max() >= b->max) {
+            l = b->max+1; break;
+          }
+          l = i.max()+1;
+        }
+        ++i;
+      }
+      if (l <= b->max)
+        s += b->clear(l,b->max);
+      if (s == 0)
+        return false;
+      _size -= s;
+      bits_pruned();
+      return true;
+    }
     if (fst()==NULL) { return false; }
     if (!i()) {
       fst()->dispose(home,lst()); fst(NULL); lst(NULL);
@@ -384,6 +941,20 @@ namespace Gecode { namespace Set {
   template<class I> bool
   LUBndSet::excludeI(Space& home, I& i) {
     if (!i()) { return false; }
+    if (bitset()) {
+      if (empty())
+        return false;
+      BitBnd* b = bits();
+      unsigned int s = 0;
+      for (; i() && (i.min() <= b->max); ++i)
+        if (i.max() >= b->min)
+          s += b->clear(std::max(i.min(),b->min),std::min(i.max(),b->max));
+      if (s == 0)
+        return false;
+      _size -= s;
+      bits_pruned();
+      return true;
+    }
     BndSetRanges j(*this);
     Iter::Ranges::Diff<BndSetRanges,I> ij(j,i);
     bool ret = overwrite(home, ij);
@@ -393,10 +964,67 @@ namespace Gecode { namespace Set {
 
   forceinline void
   LUBndSet::excludeAll(Space& home) {
+    if (bitset()) {
+      if (!empty())
+        bits()->clear(min(),max());
+      _size=0;
+      bits_pruned();
+      return;
+    }
     fst()->dispose(home,lst()); fst(NULL); lst(NULL);
     _size=0;
   }
 
+  template<class W> bool
+  LUBndSet::intersectW(const W& w) {
+    if (empty())
+      return false;
+    const int bpb = static_cast<int>(Support::BitSetData::bpb);
+    BitBnd* b = bits();
+    int o = b->base / bpb;
+    unsigned int s = 0;
+    for (int k=o+(b->min-b->base)/bpb, l=o+(b->max-b->base)/bpb;
+         k<=l; k++) {
+      Support::BitSetData& dk = b->data[k-o];
+      Support::BitSetData n = Support::BitSetData::a(dk,~Words::get(w,k));
+      if (n.none())
+        continue;
+      s += n.ones();
+      dk.a(~n);
+    }
+    if (s == 0)
+      return false;
+    _size -= s;
+    bits_pruned();
+    assert(isConsistent());
+    return true;
+  }
+
+  template<class W> bool
+  LUBndSet::excludeW(const W& w) {
+    if (empty())
+      return false;
+    const int bpb = static_cast<int>(Support::BitSetData::bpb);
+    BitBnd* b = bits();
+    int o = b->base / bpb;
+    unsigned int s = 0;
+    for (int k=std::max(o+(b->min-b->base)/bpb,w.fst()),
+           l=std::min(o+(b->max-b->base)/bpb,w.lst()); k<=l; k++) {
+      Support::BitSetData& dk = b->data[k-o];
+      Support::BitSetData n = Support::BitSetData::a(dk,w[k]);
+      if (n.none())
+        continue;
+      s += n.ones();
+      dk.a(~n);
+    }
+    if (s == 0)
+      return false;
+    _size -= s;
+    bits_pruned();
+    assert(isConsistent());
+    return true;
+  }
+
   /*
    * A complement iterator spezialized for the BndSet limits
    *
@@ -108,6 +108,21 @@ namespace Gecode { namespace Set {
     return notify(home, me, d);
   }
 
+  /*
+   * Representation of bounds
+   *
+   */
+  void
+  SetVarImp::bitsets(Space& home) {
+    if (!lub.empty() &&
+        (static_cast<unsigned int>(lub.max()-lub.min()) < bits_max) &&
+        (glb.empty() ||
+         ((glb.min() >= lub.min()) && (glb.max() <= lub.max())))) {
+      glb.bitset(home,lub.min(),lub.max());
+      lub.bitset(home,lub.min(),lub.max());
+    }
+  }
+
   /*
    * Copying variables
    *
@@ -122,7 +137,7 @@ namespace Gecode { namespace Set {
     if (x.assigned()) {
       glb.become(home,lub);
     } else {
-      glb.update(home,x.glb);
+      glb.update(home,x.glb,lub.min(),lub.max());
     }
   }
 
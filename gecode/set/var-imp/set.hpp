@@ -58,6 +58,7 @@ namespace Gecode { namespace Set {
       lub(home,ubMin,ubMax), glb(home,lbMin,lbMax) {
     glb.card(std::max(cardMin, glb.size() ));
     lub.card(std::min(cardMax, lub.size() ));
+    bitsets(home);
   }
 
   forceinline
@@ -68,6 +69,7 @@ namespace Gecode { namespace Set {
       lub(home,ubMin,ubMax), glb(home,theGlb) {
     glb.card(std::max(cardMin, glb.size() ));
     lub.card(std::min(cardMax, lub.size() ));
+    bitsets(home);
   }
 
   forceinline
@@ -78,6 +80,7 @@ namespace Gecode { namespace Set {
       lub(home,theLub), glb(home,lbMin,lbMax) {
     glb.card(std::max(cardMin, glb.size() ));
     lub.card(std::min(cardMax, lub.size() ));
+    bitsets(home);
   }
 
   forceinline
@@ -87,6 +90,7 @@ namespace Gecode { namespace Set {
     : SetVarImpBase(home), lub(home,theLub), glb(home,theGlb) {
     glb.card(std::max(cardMin, glb.size() ));
     lub.card(std::min(cardMax, lub.size() ));
+    bitsets(home);
   }
 
 
@@ -179,10 +183,7 @@ namespace Gecode { namespace Set {
 
   forceinline ModEvent
   SetVarImp::intersect(Space& home,int i, int j) {
-    BndSetRanges lb(glb);
-    Iter::Ranges::Singleton s(i,j);
-    Iter::Ranges::Diff<BndSetRanges, Iter::Ranges::Singleton> probe(lb, s);
-    if (probe())
+    if (!glb.empty() && ((glb.min() < i) || (glb.max() > j)))
       return fail(home);
     if (assigned())
       return ME_SET_NONE;
@@ -239,9 +240,7 @@ namespace Gecode { namespace Set {
   SetVarImp::intersectI_full(Space& home, int mi, int ma, I& iterator) {
     Iter::Ranges::SingletonAppend<I> si(mi,ma,iterator);
     if (lub.intersectI(home, si)) {
-      BndSetRanges ub(lub);
-      BndSetRanges lb(glb);
-      if (!Iter::Ranges::subset(lb,ub)) {
+      if (!glb.subset(lub)) {
         glb.become(home, lub);
         glb.card(glb.size());
         lub.card(glb.size());
@@ -272,11 +271,8 @@ namespace Gecode { namespace Set {
   SetVarImp::include(Space& home, int i, int j) {
     if (j<i)
       return ME_SET_NONE;
-    BndSetRanges ub(lub);
-    Iter::Ranges::Singleton sij(i,j);
-    if (!Iter::Ranges::subset(sij,ub)) {
+    if (!lub.subset(i,j))
       return fail(home);
-    }
     SetDelta d;
     if (glb.include(home, i, j, d))
       return processGlbChange(home, d);
@@ -313,9 +309,7 @@ namespace Gecode { namespace Set {
   SetVarImp::includeI_full(Space& home, int mi, int ma, I& iterator) {
     Iter::Ranges::SingletonAppend<I> si(mi,ma,iterator);
     if (glb.includeI(home, si)) {
-      BndSetRanges ub(lub);
-      BndSetRanges lb(glb);
-      if (!Iter::Ranges::subset(lb,ub)) {
+      if (!glb.subset(lub)) {
         glb.become(home, lub);
         glb.card(glb.size());
         lub.card(glb.size());
@@ -346,10 +340,7 @@ namespace Gecode { namespace Set {
   SetVarImp::exclude(Space& home, int i, int j) {
     if (j<i)
       return ME_SET_NONE;
-    Iter::Ranges::Singleton sij(i,j);
-    BndSetRanges lb(glb);
-    Iter::Ranges::Inter<Iter::Ranges::Singleton,BndSetRanges> probe(sij,lb);
-    if (probe())
+    if (!glb.disjoint(i,j))
       return fail(home);
     SetDelta d;
     if (lub.exclude(home, i, j, d))
@@ -386,9 +377,7 @@ namespace Gecode { namespace Set {
   SetVarImp::excludeI_full(Space& home, int mi, int ma, I& iterator) {
     Iter::Ranges::SingletonAppend<I> si(mi,ma,iterator);
     if (lub.excludeI(home, si)) {
-      BndSetRanges ub(lub);
-      BndSetRanges lb(glb);
-      if (!Iter::Ranges::subset(lb,ub)) {
+      if (!glb.subset(lub)) {
         glb.become(home, lub);
         glb.card(glb.size());
         lub.card(glb.size());
@@ -415,6 +404,62 @@ namespace Gecode { namespace Set {
     return ME_SET_NONE;
   }
 
+  /*
+   * Word-parallel access and update
+   *
+   */
+
+  forceinline bool
+  SetVarImp::words(void) const {
+    return glb.bitset() && lub.bitset();
+  }
+
+  forceinline BndSetWords
+  SetVarImp::glbWords(void) const {
+    return BndSetWords(glb);
+  }
+
+  forceinline BndSetWords
+  SetVarImp::lubWords(void) const {
+    return BndSetWords(lub);
+  }
+
+  template<class W>
+  forceinline ModEvent
+  SetVarImp::includeW(Space& home, const W& w) {
+    assert(words());
+    if (!Words::subset(w,lubWords()))
+      return fail(home);
+    if (assigned() || !glb.includeW(w))
+      return ME_SET_NONE;
+    SetDelta d;
+    return processGlbChange(home, d);
+  }
+
+  template<class W>
+  forceinline ModEvent
+  SetVarImp::excludeW(Space& home, const W& w) {
+    assert(words());
+    if (!Words::disjoint(glbWords(),w))
+      return fail(home);
+    if (assigned() || !lub.excludeW(w))
+      return ME_SET_NONE;
+    SetDelta d;
+    return processLubChange(home, d);
+  }
+
+  template<class W>
+  forceinline ModEvent
+  SetVarImp::intersectW(Space& home, const W& w) {
+    assert(words());
+    if (!Words::subset(glbWords(),w))
+      return fail(home);
+    if (assigned() || !lub.intersectW(w))
+      return ME_SET_NONE;
+    SetDelta d;
+    return processLubChange(home, d);
+  }
+
   /*
    * Copying a variable
    *
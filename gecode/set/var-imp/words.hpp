@@ -0,0 +1,224 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Set {
+
+  /**
+   * \brief Word sources for sets represented as bitsets
+   *
+   * A word source gives access to a set as a sequence of data elements
+   * of bitsets. Data element \a k (with \a k between fst() and lst())
+   * contains the values from \a k times the bits per data element on.
+   * All data elements outside fst() to lst() are empty. A word source
+   * is empty if fst() is larger than lst().
+   *
+   * Word sources are the word-parallel counterpart to range iterators
+   * and can only be used if all involved sets are represented as
+   * bitsets.
+   */
+  namespace Words {
+
+    /// Word source for the intersection of word sources \a W0 and \a W1
+    template<class W0, class W1>
+    class Inter {
+    protected:
+      /// First word source
+      W0 w0;
+      /// Second word source
+      W1 w1;
+    public:
+      /// Initialize with word sources \a v0 and \a v1
+      Inter(const W0& v0, const W1& v1);
+      /// Return index of first data element
+      int fst(void) const;
+      /// Return index of last data element
+      int lst(void) const;
+      /// Return data element \a k
+      Support::BitSetData operator [](int k) const;
+    };
+
+    /// Word source for the union of word sources \a W0 and \a W1
+    template<class W0, class W1>
+    class Union {
+    protected:
+      /// First word source
+      W0 w0;
+      /// Second word source
+      W1 w1;
+    public:
+      /// Initialize with word sources \a v0 and \a v1
+      Union(const W0& v0, const W1& v1);
+      /// Return index of first data element
+      int fst(void) const;
+      /// Return index of last data element
+      int lst(void) const;
+      /// Return data element \a k
+      Support::BitSetData operator [](int k) const;
+    };
+
+    /// Word source for the difference of word sources \a W0 and \a W1
+    template<class W0, class W1>
+    class Diff {
+    protected:
+      /// First word source
+      W0 w0;
+      /// Second word source
+      W1 w1;
+    public:
+      /// Initialize with word sources \a v0 and \a v1
+      Diff(const W0& v0, const W1& v1);
+      /// Return index of first data element
+      int fst(void) const;
+      /// Return index of last data element
+      int lst(void) const;
+      /// Return data element \a k
+      Support::BitSetData operator [](int k) const;
+    };
+
+    /// Return data element \a k of word source \a w (empty if outside)
+    template<class W>
+    Support::BitSetData get(const W& w, int k);
+    /// Return number of values in word source \a w
+    template<class W>
+    unsigned int size(const W& w);
+    /// Test whether all values of \a w0 are included in \a w1
+    template<class W0, class W1>
+    bool subset(const W0& w0, const W1& w1);
+    /// Test whether \a w0 and \a w1 have no value in common
+    template<class W0, class W1>
+    bool disjoint(const W0& w0, const W1& w1);
+
+
+    template<class W>
+    forceinline Support::BitSetData
+    get(const W& w, int k) {
+      if ((k >= w.fst()) && (k <= w.lst()))
+        return w[k];
+      Support::BitSetData e; e.init(false);
+      return e;
+    }
+
+    template<class W>
+    forceinline unsigned int
+    size(const W& w) {
+      unsigned int s = 0;
+      for (int k=w.fst(), l=w.lst(); k<=l; k++)
+        s += w[k].ones();
+      return s;
+    }
+
+    template<class W0, class W1>
+    forceinline bool
+    subset(const W0& w0, const W1& w1) {
+      for (int k=w0.fst(), l=w0.lst(); k<=l; k++)
+        if (!Support::BitSetData::a(w0[k],~get(w1,k)).none())
+          return false;
+      return true;
+    }
+
+    template<class W0, class W1>
+    forceinline bool
+    disjoint(const W0& w0, const W1& w1) {
+      int f = std::max(w0.fst(),w1.fst());
+      int l = std::min(w0.lst(),w1.lst());
+      for (int k=f; k<=l; k++)
+        if (!Support::BitSetData::a(w0[k],w1[k]).none())
+          return false;
+      return true;
+    }
+
+
+    template<class W0, class W1>
+    forceinline
+    Inter<W0,W1>::Inter(const W0& v0, const W1& v1) : w0(v0), w1(v1) {}
+    template<class W0, class W1>
+    forceinline int
+    Inter<W0,W1>::fst(void) const {
+      return std::max(w0.fst(),w1.fst());
+    }
+    template<class W0, class W1>
+    forceinline int
+    Inter<W0,W1>::lst(void) const {
+      return std::min(w0.lst(),w1.lst());
+    }
+    template<class W0, class W1>
+    forceinline Support::BitSetData
+    Inter<W0,W1>::operator [](int k) const {
+      return Support::BitSetData::a(w0[k],w1[k]);
+    }
+
+    template<class W0, class W1>
+    forceinline
+    Union<W0,W1>::Union(const W0& v0, const W1& v1) : w0(v0), w1(v1) {}
+    template<class W0, class W1>
+    forceinline int
+    Union<W0,W1>::fst(void) const {
+      if (w0.fst() > w0.lst())
+        return w1.fst();
+      if (w1.fst() > w1.lst())
+        return w0.fst();
+      return std::min(w0.fst(),w1.fst());
+    }
+    template<class W0, class W1>
+    forceinline int
+    Union<W0,W1>::lst(void) const {
+      if (w0.fst() > w0.lst())
+        return w1.lst();
+      if (w1.fst() > w1.lst())
+        return w0.lst();
+      return std::max(w0.lst(),w1.lst());
+    }
+    template<class W0, class W1>
+    forceinline Support::BitSetData
+    Union<W0,W1>::operator [](int k) const {
+      return Support::BitSetData::o(get(w0,k),get(w1,k));
+    }
+
+    template<class W0, class W1>
+    forceinline
+    Diff<W0,W1>::Diff(const W0& v0, const W1& v1) : w0(v0), w1(v1) {}
+    template<class W0, class W1>
+    forceinline int
+    Diff<W0,W1>::fst(void) const {
+      return w0.fst();
+    }
+    template<class W0, class W1>
+    forceinline int
+    Diff<W0,W1>::lst(void) const {
+      return w0.lst();
+    }
+    template<class W0, class W1>
+    forceinline Support::BitSetData
+    Diff<W0,W1>::operator [](int k) const {
+      return Support::BitSetData::a(w0[k],~get(w1,k));
+    }
+
+  }
+
+}}
+
+// STATISTICS: set-var
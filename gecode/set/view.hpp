@@ -142,6 +142,22 @@ namespace Gecode { namespace Set {
     template<class I> ModEvent intersectI(Space& home, I& iter);
     //@}
 
+    /// \name Word-parallel access and update
+    //@{
+    /// Test whether both bounds are represented as bitsets
+    bool words(void) const;
+    /// Return word source for greatest lower bound (only if words())
+    BndSetWords glbWords(void) const;
+    /// Return word source for least upper bound (only if words())
+    BndSetWords lubWords(void) const;
+    /// Include set described by word source \a w in greatest lower bound
+    template<class W> ModEvent includeW(Space& home, const W& w);
+    /// Remove set described by word source \a w from least upper bound
+    template<class W> ModEvent excludeW(Space& home, const W& w);
+    /// Intersect least upper bound with set described by word source \a w
+    template<class W> ModEvent intersectW(Space& home, const W& w);
+    //@}
+
     /// \name Delta information for advisors
     //@{
     /// Return modification event
@@ -165,6 +165,31 @@ namespace Gecode { namespace Set {
     return x->intersectI(home, iter);
   }
 
+  forceinline bool
+  SetView::words(void) const {
+    return x->words();
+  }
+  forceinline BndSetWords
+  SetView::glbWords(void) const {
+    return x->glbWords();
+  }
+  forceinline BndSetWords
+  SetView::lubWords(void) const {
+    return x->lubWords();
+  }
+  template<class W> forceinline ModEvent
+  SetView::includeW(Space& home, const W& w) {
+    return x->includeW(home, w);
+  }
+  template<class W> forceinline ModEvent
+  SetView::excludeW(Space& home, const W& w) {
+    return x->excludeW(home, w);
+  }
+  template<class W> forceinline ModEvent
+  SetView::intersectW(Space& home, const W& w) {
+    return x->intersectW(home, w);
+  }
+
 
   /*
    * Delta information for advisors
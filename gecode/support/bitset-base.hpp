@@ -45,12 +45,14 @@
 
 #if defined(_M_IX86)
 #pragma intrinsic(_BitScanForward)
+#pragma intrinsic(_BitScanReverse)
 #pragma intrinsic(__popcnt)
 #define GECODE_SUPPORT_MSVC_32
 #endif
 
 #if defined(_M_X64) || defined(_M_IA64)
 #pragma intrinsic(_BitScanForward64)
+#pragma intrinsic(_BitScanReverse64)
 #pragma intrinsic(__popcnt64)
 #define GECODE_SUPPORT_MSVC_64
 #endif
@@ -74,6 +76,8 @@ namespace Gecode { namespace Support {
 #endif
     /// The bits
     Base bits;
+    /// Return mask for bits \a i to \a j
+    static Base mask(unsigned int i, unsigned int j);
   public:
     /// Bits per base
     static const unsigned int bpb =
@@ -92,6 +96,14 @@ namespace Gecode { namespace Support {
     void clear(unsigned int i);
     /// Return next set bit with position greater or equal to \a i (there must be a bit)
     unsigned int next(unsigned int i=0U) const;
+    /// Return previous set bit with position less or equal to \a i (there must be a bit)
+    unsigned int prev(unsigned int i) const;
+    /// Test whether any bit from bit \a i to bit \a j is set
+    bool any(unsigned int i, unsigned int j) const;
+    /// Set bits from bit \a i to bit \a j
+    void set(unsigned int i, unsigned int j);
+    /// Clear bits from bit \a i to bit \a j
+    void clear(unsigned int i, unsigned int j);
     /// Whether all bits are set
     bool all(void) const;
     /// Whether all bits from bit 0 to bit \a i are set
@@ -102,6 +114,8 @@ namespace Gecode { namespace Support {
     bool none(unsigned int i) const;
     /// Return the number of bits set
     unsigned int ones(void) const;
+    /// Return the number of bits set from bit \a i to bit \a j
+    unsigned int ones(unsigned int i, unsigned int j) const;
     /// Return the number of bits not set
     unsigned int zeroes(void) const;
     /// Check whether exactly one bit is set
@@ -288,9 +302,49 @@ namespace Gecode { namespace Support {
 #else
     while (!get(i)) i++;
     return i;
+#endif
+  }
+  forceinline BitSetData::Base
+  BitSetData::mask(unsigned int i, unsigned int j) {
+    assert((i <= j) && (j < bpb));
+    return (~static_cast<Base>(0U) >> (bpb-1U-(j-i))) << i;
+  }
+  forceinline unsigned int
+  BitSetData::prev(unsigned int i) const {
+    const Base b = bits & mask(0U,i);
+    assert(b != static_cast<Base>(0));
+#if defined(GECODE_SUPPORT_MSVC_32)
+    assert(bpb == 32);
+    unsigned long int p;
+    _BitScanReverse(&p,b);
+    return static_cast<unsigned int>(p);
+#elif defined(GECODE_SUPPORT_MSVC_64)
+    assert(bpb == 64);
+    unsigned long int p;
+    _BitScanReverse64(&p,b);
+    return static_cast<unsigned int>(p);
+#else
+#if defined(__GNUC__)
+    if (bpb == 64)
+      return 63U - static_cast<unsigned int>(__builtin_clzll(b));
+#endif
+    while (!get(i)) i--;
+    return i;
 #endif
   }
   forceinline bool
+  BitSetData::any(unsigned int i, unsigned int j) const {
+    return (bits & mask(i,j)) != static_cast<Base>(0U);
+  }
+  forceinline void
+  BitSetData::set(unsigned int i, unsigned int j) {
+    bits |= mask(i,j);
+  }
+  forceinline void
+  BitSetData::clear(unsigned int i, unsigned int j) {
+    bits &= ~mask(i,j);
+  }
+  forceinline bool
   BitSetData::all(void) const {
     return bits == ~static_cast<Base>(0U);
   }
@@ -333,6 +387,12 @@ namespace Gecode { namespace Support {
 #endif
   }
   forceinline unsigned int
+  BitSetData::ones(unsigned int i, unsigned int j) const {
+    BitSetData m;
+    m.bits = bits & mask(i,j);
+    return m.ones();
+  }
+  forceinline unsigned int
   BitSetData::zeroes(void) const {
     return bpb - ones();
   }
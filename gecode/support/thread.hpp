@@ -336,6 +336,15 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /**
+     * \brief Pin the calling thread to processing unit \a pu
+     *
+     * Returns false if the operating system does not support
+     * thread affinity or the thread could not be pinned.
+     */
+    GECODE_SUPPORT_EXPORT static bool affinity(unsigned int pu);
+    /// Return memory node of processing unit \a pu (0 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int node(unsigned int pu);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
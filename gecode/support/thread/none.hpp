@@ -76,6 +76,14 @@ namespace Gecode { namespace Support {
   Thread::npu(void) {
     return 1;
   }
+  inline bool
+  Thread::affinity(unsigned int) {
+    return false;
+  }
+  inline unsigned int
+  Thread::node(unsigned int) {
+    return 0;
+  }
 
 
 }}
@@ -35,6 +35,11 @@
 
 #ifdef GECODE_THREADS_PTHREADS
 
+#ifdef __linux__
+#include <sched.h>
+#include <cstdio>
+#endif
+
 namespace Gecode { namespace Support {
 
   /// Function to start execution
@@ -55,6 +60,42 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[pthread_create]");
   }
 
+  bool
+  Thread::affinity(unsigned int pu) {
+#if defined(__linux__) && defined(CPU_SET)
+    if (pu >= CPU_SETSIZE)
+      return false;
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    CPU_SET(pu, &cs);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cs) == 0;
+#else
+    (void) pu;
+    return false;
+#endif
+  }
+
+  unsigned int
+  Thread::node(unsigned int pu) {
+#ifdef __linux__
+    // Use the physical package as memory nodes follow packages
+    char fn[80];
+    sprintf(fn, "/sys/devices/system/cpu/cpu%u/topology/physical_package_id",
+            pu);
+    FILE* f = fopen(fn, "r");
+    if (f == NULL)
+      return 0;
+    int n = 0;
+    if (fscanf(f, "%d", &n) != 1)
+      n = 0;
+    fclose(f);
+    return (n > 0) ? static_cast<unsigned int>(n) : 0;
+#else
+    (void) pu;
+    return 0;
+#endif
+  }
+
 }}
 
 #endif
@@ -57,6 +57,20 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[Windows::CloseHandle]");
   }
 
+  bool
+  Thread::affinity(unsigned int pu) {
+    if (pu >= 8*sizeof(DWORD_PTR))
+      return false;
+    DWORD_PTR mask = static_cast<DWORD_PTR>(1) << pu;
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+  }
+
+  unsigned int
+  Thread::node(unsigned int) {
+    // Requires a newer Windows API than the one targeted
+    return 0;
+  }
+
 }}
 
 #endif
@@ -39,6 +39,16 @@
 #include <ctime>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define GECODE_SUPPORT_RDTSC
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+#define GECODE_SUPPORT_RDTSC
+#else
+#include <chrono>
+#endif
+
 namespace Gecode { namespace Support {
 
   /** \brief %Timer
@@ -94,6 +104,26 @@ namespace Gecode { namespace Support {
 #endif
   }
 
+  /**
+   * \brief Return time stamp in ticks
+   *
+   * Uses the processor's time stamp counter where available and
+   * a monotonic clock in nanoseconds otherwise. Only the difference
+   * between two time stamps taken by the same thread is meaningful.
+   *
+   * \ingroup FuncSupport
+   */
+  inline unsigned long long int
+  ticks(void) {
+#ifdef GECODE_SUPPORT_RDTSC
+    return static_cast<unsigned long long int>(__rdtsc());
+#else
+    return static_cast<unsigned long long int>
+      (std::chrono::duration_cast<std::chrono::nanoseconds>
+       (std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+  }
+
 }}
 
 // STATISTICS: support-any
@@ -60,6 +60,94 @@ namespace Test { namespace Branch {
   Int l_2("Large::2",d_large,2);
   Int l_3("Large::3",d_large,3);
 
+  /// %Space for comparing heap-based with scanning view selection
+  class WideSpace : public Gecode::Space {
+  public:
+    /// Variables
+    Gecode::IntVarArray x;
+    /// Create space for \a n variables and variable selection \a vs
+    WideSpace(int n, Gecode::IntVarBranch vs)
+      : x(*this,n,0,9) {
+      using namespace Gecode;
+      for (int i=0; i<n; i++)
+        rel(*this, x[i], IRT_GQ, static_cast<int>(Base::rand(10)));
+      for (int i=0; i+1<n; i++)
+        rel(*this, x[i], IRT_NQ, x[i+1]);
+      branch(*this, x, vs, INT_VAL_MIN());
+    }
+    /// Constructor for cloning \a s
+    WideSpace(WideSpace& s) : Gecode::Space(s) {
+      x.update(*this, s.x);
+    }
+    /// Copy space during cloning
+    virtual Gecode::Space* copy(void) {
+      return new WideSpace(*this);
+    }
+  };
+
+  /// %Test that heap-based view selection selects the same views
+  class Wide : public Base {
+  protected:
+    /// Number of variables (sufficiently many for using a heap)
+    int n;
+    /// Variable selection using a heap
+    Gecode::IntVarBranch h;
+    /// Same variable selection using a merit function
+    Gecode::IntVarBranch m;
+  public:
+    /// Create and register test
+    Wide(const std::string& s,
+         Gecode::IntVarBranch h0, Gecode::IntVarBranch m0)
+      : Base("Branch::Int::Wide::"+s),
+        n(Gecode::Kernel::Config::heap_views+44), h(h0), m(m0) {}
+    /// Perform test
+    virtual bool run(void) {
+      using namespace Gecode;
+      unsigned int seed = Base::rand.seed();
+      WideSpace* hs = new WideSpace(n,h);
+      Base::rand.seed(seed);
+      WideSpace* ms = new WideSpace(n,m);
+      Search::Options o;
+      o.stop = Search::Stop::fail(100);
+      DFS<WideSpace> he(hs,o), me(ms,o);
+      delete hs; delete ms;
+      // Compare first solutions and size of search trees
+      for (int k=0; k<10; k++) {
+        WideSpace* hsol = he.next();
+        WideSpace* msol = me.next();
+        if ((hsol == NULL) != (msol == NULL)) {
+          delete hsol; delete msol;
+          return false;
+        }
+        if (hsol == NULL)
+          break;
+        for (int i=0; i<n; i++)
+          if (hsol->x[i].val() != msol->x[i].val()) {
+            delete hsol; delete msol;
+            return false;
+          }
+        delete hsol; delete msol;
+      }
+      return he.statistics().node == me.statistics().node;
+    }
+  };
+
+  /// Merit function for domain size
+  double size(const Gecode::Space&, Gecode::IntVar x, int) {
+    return static_cast<double>(x.size());
+  }
+  /// Merit function for minimum
+  double min(const Gecode::Space&, Gecode::IntVar x, int) {
+    return static_cast<double>(x.min());
+  }
+
+  Wide w_size_min("SizeMin",Gecode::INT_VAR_SIZE_MIN(),
+                  Gecode::INT_VAR_MERIT_MIN(&size));
+  Wide w_size_max("SizeMax",Gecode::INT_VAR_SIZE_MAX(),
+                  Gecode::INT_VAR_MERIT_MAX(&size));
+  Wide w_min_max("MinMax",Gecode::INT_VAR_MIN_MAX(),
+                 Gecode::INT_VAR_MERIT_MAX(&min));
+
 }}
 
 // STATISTICS: test-branch
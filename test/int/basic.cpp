@@ -53,6 +53,9 @@ namespace Test { namespace Int {
        /// Initialize test
        Basic(Gecode::IntArgs& i)
          : Test("Basic::B",3,Gecode::IntSet(i),true) {}
+       /// Initialize test with name \a s
+       Basic(const std::string& s, Gecode::IntArgs& i)
+         : Test("Basic::"+s,3,Gecode::IntSet(i),true) {}
        /// Check whether \a x is a solution
        virtual bool solution(const Assignment&) const {
          return true;
@@ -69,8 +72,11 @@ namespace Test { namespace Int {
      };
 
      Gecode::IntArgs i({1,2,3,4});
+     // Too wide for a bitset, the domains are represented by range lists
+     Gecode::IntArgs w({-1000,-2,0,1,1000});
      Basic b1(3);
      Basic b2(i);
+     Basic b3("Wide",w);
      //@}
 
    }
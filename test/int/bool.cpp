@@ -437,6 +437,48 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for conjunction of clauses
+     class Clauses : public Test {
+     protected:
+       /// The clauses
+       Gecode::IntArgs c;
+       /// How often each variable is passed to the constraint
+       int m;
+     public:
+       /// Construct and register test
+       Clauses(const std::string& s, int n, const Gecode::IntArgs& c0,
+               int m0=1)
+         : Test("Bool::Clauses::"+s,n,0,1), c(c0), m(m0) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int i = 0;
+         while (i < c.size()) {
+           bool sat = false;
+           for ( ; (i < c.size()) && (c[i] != 0); i++)
+             if (c[i] > 0)
+               sat = sat || (x[(c[i]-1) % x.size()] == 1);
+             else
+               sat = sat || (x[(-c[i]-1) % x.size()] == 0);
+           if (!sat)
+             return false;
+           i++;
+         }
+         return true;
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         int n = x.size();
+         BoolVarArgs b(m*n);
+         for (int i=n; i--; ) {
+           b[i]=channel(home,x[i]);
+           for (int j=1; j<m; j++)
+             b[j*n+i]=b[i];
+         }
+         clauses(home, b, c);
+       }
+     };
+
      /// %Test for if-then-else-constraint
      class ITEInt : public Test {
      public:
@@ -533,6 +575,14 @@ namespace Test { namespace Int {
      };
 
      Create c;
+
+     Clauses clauses_a("A",4,{1,2,-3,0, -1,3,0, 2,-4,0, -2,-3,4,0, 1,3,4,0});
+     Clauses clauses_b("B",5,{1,-2,0, 2,-3,0, 3,-4,0, 4,-5,0, 5,-1,0,
+                              -1,-3,-5,0});
+     Clauses clauses_unit("Unit",4,{1,0, -2,3,0, -3,4,0, 2,-4,-1,0});
+     Clauses clauses_dup("Dup",4,{1,1,-2,0, 2,-2,3,0, -1,-3,0, 3,4,4});
+     Clauses clauses_fail("Fail",3,{1,2,0, -1,0, -2,3,0, -3,0});
+     Clauses clauses_shared("Shared",3,{1,-5,0, 4,2,0, -3,6,-1,0, 2,3},2);
      ITEInt itebnd(Gecode::IPL_BND);
      ITEInt itedom(Gecode::IPL_DOM);
      ITEBool itebool;
@@ -39,6 +39,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
 
 namespace Test { namespace Int {
 
@@ -673,6 +674,13 @@ namespace Test { namespace Int {
                .finalize();
              (void) new TupleSetTest("A",pos,IntSet(0,6),ts,true);
            }
+           {
+             TupleSet ts(randomTupleSet(5,-10,10,0.05));
+             ts.save("gecode-test-tupleset.bin");
+             TupleSet ls("gecode-test-tupleset.bin");
+             std::remove("gecode-test-tupleset.bin");
+             (void) new RandomTupleSetTest("File",pos,IntSet(-10,10),ls);
+           }
            {
              TupleSet ts(4);
              ts.finalize();
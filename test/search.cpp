@@ -148,6 +148,12 @@ namespace Test {
       virtual void constrain(const Space&) {
         fail();
       }
+      /// Archive solution (nothing to archive)
+      virtual void archive(Archive&) const {
+      }
+      /// Unarchive solution (nothing to unarchive)
+      virtual void unarchive(Archive&) {
+      }
       /// Return number of solutions
       virtual int solutions(void) const {
         return 1;
@@ -241,6 +247,24 @@ namespace Test {
           }
         }
       }
+      /// Archive solution into \a e
+      virtual void archive(Archive& e) const {
+        for (int i=0; i<x.size(); i++) {
+          e << x[i].assigned();
+          if (x[i].assigned())
+            e << x[i].val();
+        }
+      }
+      /// Unarchive solution from \a e
+      virtual void unarchive(Archive& e) {
+        for (int i=0; i<x.size(); i++) {
+          bool a; e >> a;
+          if (a) {
+            int v; e >> v;
+            rel(*this, x[i], IRT_EQ, v);
+          }
+        }
+      }
       /// Return number of solutions
       virtual int solutions(void) const {
         if (htb1 == HTB_NONE) {
@@ -480,6 +504,292 @@ namespace Test {
       }
     };
 
+    /// %Test for checkpoints of depth-first and best solution search
+    template<class Model>
+    class Checkpoint : public Test {
+    private:
+      /// Whether to use best solution search
+      bool b;
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+    public:
+      /// Initialize test
+      Checkpoint(bool b0, HowToConstrain htc,
+                 HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                 unsigned int c_d0, unsigned int a_d0)
+        : Test(std::string("Checkpoint::")+(b0 ? "BAB::" : "DFS::")+
+               Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0),
+               htb1,htb2,htb3,htc), b(b0), c_d(c_d0), a_d(a_d0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        o.stop = &f;
+        o.checkpoint = true;
+        int n = m->solutions();
+        Model* best = NULL;
+        Archive a;
+        bool restore = false;
+        while (true) {
+          // Run a new engine from the checkpoint of the previous one
+          Gecode::Search::Base<Model>* e;
+          if (b)
+            e = new Gecode::BAB<Model>(m,o);
+          else
+            e = new Gecode::DFS<Model>(m,o);
+          if (restore)
+            e->restore(a);
+          Model* s = e->next();
+          if (s != NULL) {
+            n--;
+            if (b) {
+              delete best; best = s;
+            } else {
+              delete s;
+            }
+          }
+          bool done = (s == NULL) && !e->stopped();
+          a = Archive();
+          e->checkpoint(a);
+          restore = true;
+          delete e;
+          if (done)
+            break;
+          f.limit(f.limit()+2);
+        }
+        delete m;
+        if (b) {
+          bool ok = (best == NULL) || best->best();
+          delete best;
+          return ok;
+        }
+        return n == 0;
+      }
+    };
+
+#ifdef GECODE_HAS_THREADS
+    /// %Test for embarrassingly parallel depth-first and best solution search
+    template<class Model>
+    class EPS : public Test {
+    private:
+      /// Whether to use best solution search
+      bool b;
+      /// Number of threads
+      unsigned int t;
+      /// Number of subproblems per thread
+      unsigned int sp;
+      /// Whether solutions are returned in reproducible order
+      bool r;
+      /// Run search and record archived solutions in \a a
+      bool search(std::vector<unsigned int>& a) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.parallel = Gecode::Search::PM_EPS;
+        o.subproblems = sp;
+        o.replay = r;
+        o.stop = &f;
+        int n = m->solutions();
+        Gecode::Search::Base<Model>* e;
+        if (b)
+          e = new Gecode::BAB<Model>(m,o);
+        else
+          e = new Gecode::DFS<Model>(m,o);
+        delete m;
+        Model* best = NULL;
+        while (true) {
+          Model* s = e->next();
+          if (s != NULL) {
+            n--;
+            Archive sa;
+            s->archive(sa);
+            for (int i=0; i<sa.size(); i++)
+              a.push_back(sa[i]);
+            if (b) {
+              delete best; best = s;
+            } else {
+              delete s;
+            }
+          }
+          if ((s == NULL) && !e->stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        delete e;
+        if (b) {
+          bool ok = (best == NULL) || best->best();
+          delete best;
+          return ok;
+        }
+        return n == 0;
+      }
+    public:
+      /// Initialize test
+      EPS(bool b0, HowToConstrain htc,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int t0, unsigned int sp0, bool r0)
+        : Test(std::string("EPS::")+(b0 ? "BAB::" : "DFS::")+
+               Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(t0)+"::"+str(sp0)+(r0 ? "::Replay" : ""),
+               htb1,htb2,htb3,htc), b(b0), t(t0), sp(sp0), r(r0) {}
+      /// Run test
+      virtual bool run(void) {
+        std::vector<unsigned int> a1;
+        if (!search(a1))
+          return false;
+        if (!r)
+          return true;
+        // Replay must yield the same solutions in the same order
+        std::vector<unsigned int> a2;
+        return search(a2) && (a1 == a2);
+      }
+    };
+
+    /// %Test for deterministic parallel depth-first and best solution search
+    template<class Model>
+    class Det : public Test {
+    private:
+      /// Whether to use best solution search
+      bool b;
+      /// Number of threads
+      unsigned int t;
+      /// Number of subproblems per thread
+      unsigned int sp;
+      /// Run search and record archived solutions and statistics in \a a
+      bool search(std::vector<unsigned long int>& a) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.parallel = Gecode::Search::PM_DET;
+        o.subproblems = sp;
+        o.stop = &f;
+        int n = m->solutions();
+        Gecode::Search::Base<Model>* e;
+        if (b)
+          e = new Gecode::BAB<Model>(m,o);
+        else
+          e = new Gecode::DFS<Model>(m,o);
+        delete m;
+        Model* best = NULL;
+        while (true) {
+          Model* s = e->next();
+          if (s != NULL) {
+            n--;
+            Archive sa;
+            s->archive(sa);
+            for (int i=0; i<sa.size(); i++)
+              a.push_back(sa[i]);
+            if (b) {
+              delete best; best = s;
+            } else {
+              delete s;
+            }
+          }
+          if ((s == NULL) && !e->stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        Gecode::Search::Statistics st = e->statistics();
+        a.push_back(st.node); a.push_back(st.fail);
+        delete e;
+        if (b) {
+          bool ok = (best == NULL) || best->best();
+          delete best;
+          return ok;
+        }
+        return n == 0;
+      }
+    public:
+      /// Initialize test
+      Det(bool b0, HowToConstrain htc,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int t0, unsigned int sp0)
+        : Test(std::string("Det::")+(b0 ? "BAB::" : "DFS::")+
+               Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(t0)+"::"+str(sp0),
+               htb1,htb2,htb3,htc), b(b0), t(t0), sp(sp0) {}
+      /// Run test
+      virtual bool run(void) {
+        // Solutions, their order, and statistics must be the same
+        std::vector<unsigned long int> a1, a2;
+        return search(a1) && search(a2) && (a1 == a2);
+      }
+    };
+#endif
+
+#ifdef GECODE_HAS_PROCESSES
+    /// %Test for depth-first and best solution search with worker processes
+    template<class Model>
+    class Process : public Test {
+    private:
+      /// Whether to use best solution search
+      bool b;
+      /// Number of worker processes
+      unsigned int p;
+      /// Number of subproblems per worker process
+      unsigned int sp;
+    public:
+      /// Initialize test
+      Process(bool b0, HowToConstrain htc,
+              HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+              unsigned int p0, unsigned int sp0)
+        : Test(std::string("Process::")+(b0 ? "BAB::" : "DFS::")+
+               Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(p0)+"::"+str(sp0),
+               htb1,htb2,htb3,htc), b(b0), p(p0), sp(sp0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.processes = p;
+        o.subproblems = sp;
+        o.stop = &f;
+        int n = m->solutions();
+        Gecode::Search::Base<Model>* e;
+        if (b)
+          e = new Gecode::BAB<Model>(m,o);
+        else
+          e = new Gecode::DFS<Model>(m,o);
+        delete m;
+        Model* best = NULL;
+        while (true) {
+          Model* s = e->next();
+          if (s != NULL) {
+            n--;
+            if (b) {
+              delete best; best = s;
+            } else {
+              delete s;
+            }
+          }
+          if ((s == NULL) && !e->stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        delete e;
+        if (b) {
+          bool ok = (best == NULL) || best->best();
+          delete best;
+          return ok;
+        }
+        return n == 0;
+      }
+    };
+#endif
+
     /// %Test for restart-based search
     template<class Model, template<class> class Engine>
     class RBS : public Test {
@@ -753,6 +1063,105 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Checkpoints
+        for (unsigned int c_d = 1; c_d<=3; c_d += 2)
+          for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new Checkpoint<HasSolutions>
+                    (false,HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),
+                     c_d,a_d);
+                  for (ConstrainTypes htc; htc(); ++htc)
+                    (void) new Checkpoint<HasSolutions>
+                      (true,htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d,a_d);
+                }
+            for (int i=0; i<2; i++) {
+              (void) new Checkpoint<FailImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d);
+              (void) new Checkpoint<SolveImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d);
+              (void) new Checkpoint<HasSolutions>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d);
+            }
+          }
+#ifdef GECODE_HAS_THREADS
+        // Embarrassingly parallel search
+        for (unsigned int t=2; t<=4; t++)
+          for (unsigned int sp=1; sp<=4; sp += 3)
+            for (int r=0; r<2; r++) {
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3) {
+                    (void) new EPS<HasSolutions>
+                      (false,HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),
+                       t,sp,r == 1);
+                    for (ConstrainTypes htc; htc(); ++htc)
+                      // Only lexicographic order has a unique best solution
+                      if ((r == 1) ||
+                          (htc.htc() == HTC_LEX_LE) ||
+                          (htc.htc() == HTC_LEX_GR))
+                        (void) new EPS<HasSolutions>
+                          (true,htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                           t,sp,r == 1);
+                  }
+              for (int i=0; i<2; i++) {
+                (void) new EPS<FailImmediate>
+                  (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp,r == 1);
+                (void) new EPS<SolveImmediate>
+                  (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp,r == 1);
+                (void) new EPS<HasSolutions>
+                  (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp,r == 1);
+              }
+            }
+        // Deterministic parallel search
+        for (unsigned int t=2; t<=4; t++)
+          for (unsigned int sp=1; sp<=4; sp += 3) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new Det<HasSolutions>
+                    (false,HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),t,sp);
+                  for (ConstrainTypes htc; htc(); ++htc)
+                    (void) new Det<HasSolutions>
+                      (true,htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),t,sp);
+                }
+            for (int i=0; i<2; i++) {
+              (void) new Det<FailImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp);
+              (void) new Det<SolveImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp);
+              (void) new Det<HasSolutions>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t,sp);
+            }
+          }
+#endif
+#ifdef GECODE_HAS_PROCESSES
+        // Worker processes
+        for (unsigned int p=1; p<=3; p++)
+          for (unsigned int sp=1; sp<=4; sp += 3) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new Process<HasSolutions>
+                    (false,HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),p,sp);
+                  // Only lexicographic order has a unique best solution
+                  (void) new Process<HasSolutions>
+                    (true,HTC_LEX_LE,htb1.htb(),htb2.htb(),htb3.htb(),p,sp);
+                  (void) new Process<HasSolutions>
+                    (true,HTC_LEX_GR,htb1.htb(),htb2.htb(),htb3.htb(),p,sp);
+                }
+            for (int i=0; i<2; i++) {
+              (void) new Process<FailImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p,sp);
+              (void) new Process<SolveImmediate>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p,sp);
+              (void) new Process<HasSolutions>
+                (i == 1,HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p,sp);
+            }
+          }
+#endif
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
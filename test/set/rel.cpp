@@ -50,6 +50,8 @@ namespace Test { namespace Set {
 
     static IntSet ds_33(-3,3);
     static IntSet ds_03(0,3);
+    // Too wide for bitsets, the bounds are represented by range lists
+    static IntSet ds_wide({-5000,-1,0,1,5000});
 
     /// %Test for binary set relation constraint
     class RelBin : public SetTest {
@@ -62,6 +64,11 @@ namespace Test { namespace Set {
         : SetTest("Rel::Bin::"+str(srt0)+"::S"+(shared0 ? "1":"0"),
                   shared0 ? 1 : 2,ds_33,true)
         , srt(srt0), shared(shared0){}
+      /// Create and register test with name \a s and universe \a d
+      RelBin(const std::string& s, Gecode::SetRelType srt0,
+             const Gecode::IntSet& d)
+        : SetTest("Rel::Bin::"+s+"::"+str(srt0),2,d,true)
+        , srt(srt0), shared(false) {}
       int minSymDiff(const SetAssignment& x) const {
         int x1 = shared ? x[0] : x[1];
         typedef Iter::Ranges::Diff<CountableSetRanges,CountableSetRanges> Diff;
@@ -176,6 +183,11 @@ namespace Test { namespace Set {
     RelBin _relbin_shared_disj(Gecode::SRT_DISJ,true);
     RelBin _relbin_shared_cmpl(Gecode::SRT_CMPL,true);
 
+    RelBin _relbin_wide_eq("Wide",Gecode::SRT_EQ,ds_wide);
+    RelBin _relbin_wide_lq("Wide",Gecode::SRT_LQ,ds_wide);
+    RelBin _relbin_wide_sub("Wide",Gecode::SRT_SUB,ds_wide);
+    RelBin _relbin_wide_disj("Wide",Gecode::SRT_DISJ,ds_wide);
+
     ITE _ite;
     //@}
 
@@ -58,10 +58,13 @@ int main(int argc, char** argv) {
   FlatZinc::FlatZincSpace* fg = NULL;
   Rnd rnd(opt.seed());
   try {
+    FlatZinc::FlatZincSpace* fzs = new FlatZinc::FlatZincSpace(rnd);
+    fzs->prepareThreads(opt.prepareThreads());
     if (!strcmp(filename, "-")) {
-      fg = FlatZinc::parse(cin, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(cin, p, std::cerr, fzs, rnd, opt.stream());
     } else {
-      fg = FlatZinc::parse(filename, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(filename, p, std::cerr, fzs, rnd,
+                           opt.stream());
     }
 
     if (fg) {